@@ -0,0 +1,348 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * The throughput benchmark of the Scanner.
+ * The corpus is the jquery.js of the test cases and the variants which are generated from it,
+ * which are the minified, the comment heavy, the string heavy and the non ascii sources.
+ * Each corpus is scanned warmup times, and then scanned repeat times with the timer.
+ *
+ * usage: ScannerBench [--corpus path] [--warmup count] [--repeat count] [--json path]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../src/compiler-option.h"
+#include "../src/parser/scanner.h"
+#include "../src/utils/os.h"
+#include "../test/readfile.h"
+
+namespace {
+typedef std::chrono::steady_clock Clock;
+
+enum class TokenKind {
+  IDENTIFIER = 0,
+  KEYWORD,
+  PUNCTUATOR,
+  NUMERIC,
+  STRING,
+  OTHER,
+  COUNT
+};
+
+
+const char* kTokenKindNames[] = {"identifier", "keyword", "punctuator", "numeric", "string", "other"};
+const size_t kTokenKindCount = static_cast<size_t>(TokenKind::COUNT);
+
+
+TokenKind GetTokenKind(rasp::Token token) {
+  using rasp::Token;
+  if (token == Token::JS_IDENTIFIER) {
+    return TokenKind::IDENTIFIER;
+  }
+  if (token <= Token::JS_YIELD || token == Token::JS_SET || token == Token::JS_GET ||
+      token == Token::FUTURE_STRICT_RESERVED_WORD || token == Token::FUTURE_RESERVED_WORD) {
+    return TokenKind::KEYWORD;
+  }
+  if ((token >= Token::JS_INCREMENT && token <= Token::JS_FUNCTION_GLYPH) ||
+      (token >= Token::JS_REST_PARAMETER && token <= Token::JS_RIGHT_BRACE)) {
+    return TokenKind::PUNCTUATOR;
+  }
+  if (token == Token::JS_NUMERIC_LITERAL || token == Token::JS_OCTAL_LITERAL ||
+      token == Token::JS_BINARY_LITERAL) {
+    return TokenKind::NUMERIC;
+  }
+  if (token == Token::JS_STRING_LITERAL) {
+    return TokenKind::STRING;
+  }
+  return TokenKind::OTHER;
+}
+
+
+struct Corpus {
+  std::string name;
+  std::string source;
+};
+
+
+struct KindResult {
+  size_t tokens;
+  size_t bytes;
+  double nanoseconds;
+};
+
+
+struct Result {
+  std::string name;
+  size_t bytes;
+  size_t tokens;
+  double best_nanoseconds;
+  double median_nanoseconds;
+  KindResult kinds[kTokenKindCount];
+};
+
+
+bool IsWordChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+      c == '_' || c == '$' || c == '\\' || (c & 0x80) != 0;
+}
+
+
+bool IsOperatorChar(char c) {
+  return strchr("+-*/%<>=!&|^~.?:", c) != nullptr;
+}
+
+
+/**
+ * Join the tokens of the source with the minimum separators.
+ * The line terminators before the tokens are kept for the automatic semicolon insertion.
+ */
+std::string Minify(const std::string& source) {
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<const char*> scanner(source.data(), source.data() + source.size(), compiler_option);
+  rasp::TokenStream token_stream(source.size());
+  scanner.ScanAll(&token_stream);
+  std::string minified;
+  minified.reserve(source.size());
+  for (size_t i = 0; i + 1 < token_stream.size(); i++) {
+    const char* token = source.data() + token_stream.offset(i);
+    size_t length = token_stream.length(i);
+    if (i > 0) {
+      char last = minified.back();
+      if (token_stream.has_line_terminator_before_next(i - 1)) {
+        minified += '\n';
+      } else if ((IsWordChar(last) && IsWordChar(token[0])) ||
+                 (IsOperatorChar(last) && IsOperatorChar(token[0])) ||
+                 (last >= '0' && last <= '9' && token[0] == '.')) {
+        minified += ' ';
+      }
+    }
+    minified.append(token, length);
+  }
+  return minified;
+}
+
+
+std::string Repeat(const char* block, size_t size) {
+  std::string source;
+  source.reserve(size + strlen(block) * 2);
+  for (int i = 0; source.size() < size; i++) {
+    char header[64];
+    snprintf(header, sizeof(header), "var block%d = %d;\n", i, i);
+    source += header;
+    source += block;
+  }
+  return source;
+}
+
+
+std::vector<Corpus> CreateCorpus(const char* path) {
+  std::vector<Corpus> corpus;
+  std::string jquery = rasp::testing::ReadFile(path);
+  corpus.push_back(Corpus{"jquery", jquery});
+  corpus.push_back(Corpus{"minified", Minify(jquery)});
+  corpus.push_back(Corpus{"comment-heavy", Repeat(
+      "/*!\n"
+      " * Library v1.0.0 | (c) The Authors | Released under the MIT license.\n"
+      " * Permission is hereby granted, free of charge, to any person obtaining a copy.\n"
+      " */\n"
+      "/**\n"
+      " * Compute the length of the value.\n"
+      " * @param {number} a The first value.\n"
+      " * @param {string} b The second value.\n"
+      " * @return {number} The sum of a and the length of b.\n"
+      " */\n"
+      "function compute(a, b) {\n"
+      "  // The length of the string is added.\n"
+      "  return a + b.length; /* trailing */\n"
+      "}\n", jquery.size())});
+  corpus.push_back(Corpus{"string-heavy", Repeat(
+      "var message = \"The quick brown fox jumps over the lazy dog, 'quoted' and \\\"escaped\\\".\" +\n"
+      "    'Single quoted string with the \\x41\\u0042 escapes and the \\n\\t control characters.' +\n"
+      "    \"A long string literal which has no escape sequence at all, so the scanner can skip it.\";\n",
+      jquery.size())});
+  corpus.push_back(Corpus{"non-ascii", Repeat(
+      "/* \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe3\x82\xb3\xe3\x83\xa1\xe3\x83\xb3\xe3\x83\x88 */\n"
+      "var caf\xc3\xa9_\\u5909\\u6570 = '\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe6\x96\x87\xe5\xad\x97\xe5\x88\x97 "
+      "\xc3\xbc\xc3\xb1\xc3\xaf\xc3\xa7\xc3\xb6\xc3\xb0\xc3\xa9' + "
+      "\"\xce\x95\xce\xbb\xce\xbb\xce\xb7\xce\xbd\xce\xb9\xce\xba\xce\xac \xe2\x82\xac\";"
+      " // \xe8\xa1\x8c\xe3\x82\xb3\xe3\x83\xa1\xe3\x83\xb3\xe3\x83\x88\n", jquery.size())});
+  return corpus;
+}
+
+
+size_t ScanOnce(const Corpus& corpus, const rasp::CompilerOption& compiler_option, rasp::TokenStream* token_stream) {
+  token_stream->Clear();
+  const char* begin = corpus.source.data();
+  rasp::Scanner<const char*> scanner(begin, begin + corpus.source.size(), compiler_option);
+  scanner.ScanAll(token_stream);
+  return token_stream->size();
+}
+
+
+/**
+ * Measure the time of each token kind by timing the each Scan.
+ * The time of the token includes the white spaces and the comments after it,
+ * and the overhead of the clock is subtracted.
+ */
+void MeasureKinds(const Corpus& corpus, const rasp::CompilerOption& compiler_option, Result* result) {
+  const int kClockSamples = 10000;
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < kClockSamples; i++) {
+    Clock::now();
+  }
+  double clock_overhead = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kClockSamples;
+  
+  const char* begin = corpus.source.data();
+  rasp::Scanner<const char*> scanner(begin, begin + corpus.source.size(), compiler_option);
+  while (1) {
+    Clock::time_point token_start = Clock::now();
+    const rasp::TokenInfo* token_info = scanner.Scan();
+    double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - token_start).count();
+    KindResult& kind = result->kinds[static_cast<size_t>(GetTokenKind(token_info->type()))];
+    kind.tokens++;
+    kind.bytes += token_info->source_length();
+    kind.nanoseconds += std::max(0.0, elapsed - clock_overhead);
+    if (token_info->type() == rasp::Token::END_OF_INPUT) {
+      break;
+    }
+  }
+}
+
+
+Result Run(const Corpus& corpus, int warmup, int repeat) {
+  rasp::CompilerOption compiler_option;
+  rasp::TokenStream token_stream(corpus.source.size());
+  Result result = Result();
+  result.name = corpus.name;
+  result.bytes = corpus.source.size();
+  for (int i = 0; i < warmup; i++) {
+    result.tokens = ScanOnce(corpus, compiler_option, &token_stream);
+  }
+
+  std::vector<double> times;
+  for (int i = 0; i < repeat; i++) {
+    Clock::time_point start = Clock::now();
+    result.tokens = ScanOnce(corpus, compiler_option, &token_stream);
+    times.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+  }
+  std::sort(times.begin(), times.end());
+  result.best_nanoseconds = times.front();
+  result.median_nanoseconds = times[times.size() / 2];
+  MeasureKinds(corpus, compiler_option, &result);
+  return result;
+}
+
+
+double MegabytesPerSecond(const Result& result) {
+  return result.bytes / static_cast<double>(1 MB) / (result.median_nanoseconds / 1e9);
+}
+
+
+void PrintResults(const std::vector<Result>& results) {
+  rasp::Printf("%-14s %10s %10s %10s %12s %10s\n", "corpus", "bytes", "tokens", "MB/s", "tokens/s", "ns/token");
+  for (const Result& result: results) {
+    rasp::Printf("%-14s %10zu %10zu %10.1f %12.0f %10.2f\n",
+                 result.name.c_str(), result.bytes, result.tokens, MegabytesPerSecond(result),
+                 result.tokens / (result.median_nanoseconds / 1e9),
+                 result.median_nanoseconds / result.tokens);
+    for (size_t i = 0; i < kTokenKindCount; i++) {
+      const KindResult& kind = result.kinds[i];
+      if (kind.tokens > 0) {
+        rasp::Printf("  %-12s %10zu %10zu %10s %12s %10.2f\n", kTokenKindNames[i], kind.bytes, kind.tokens,
+                     "", "", kind.nanoseconds / kind.tokens);
+      }
+    }
+  }
+}
+
+
+void WriteJson(const char* path, const std::vector<Result>& results, int warmup, int repeat) {
+  FILE* fp = rasp::FOpen(path, "wb");
+  rasp::FPrintf(fp, "{\n  \"warmup\": %d,\n  \"repeat\": %d,\n  \"corpora\": [\n", warmup, repeat);
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result& result = results[i];
+    rasp::FPrintf(fp,
+                  "    {\n"
+                  "      \"name\": \"%s\",\n"
+                  "      \"bytes\": %zu,\n"
+                  "      \"tokens\": %zu,\n"
+                  "      \"best_ns\": %.0f,\n"
+                  "      \"median_ns\": %.0f,\n"
+                  "      \"mb_per_sec\": %.3f,\n"
+                  "      \"tokens_per_sec\": %.0f,\n"
+                  "      \"ns_per_token\": %.3f,\n"
+                  "      \"kinds\": {\n",
+                  result.name.c_str(), result.bytes, result.tokens,
+                  result.best_nanoseconds, result.median_nanoseconds, MegabytesPerSecond(result),
+                  result.tokens / (result.median_nanoseconds / 1e9),
+                  result.median_nanoseconds / result.tokens);
+    for (size_t j = 0; j < kTokenKindCount; j++) {
+      const KindResult& kind = result.kinds[j];
+      rasp::FPrintf(fp, "        \"%s\": {\"tokens\": %zu, \"bytes\": %zu, \"ns_per_token\": %.3f}%s\n",
+                    kTokenKindNames[j], kind.tokens, kind.bytes,
+                    kind.tokens > 0? kind.nanoseconds / kind.tokens: 0.0,
+                    j + 1 < kTokenKindCount? ",": "");
+    }
+    rasp::FPrintf(fp, "      }\n    }%s\n", i + 1 < results.size()? ",": "");
+  }
+  rasp::FPrintf(fp, "  ]\n}\n");
+  rasp::FClose(fp);
+}
+}
+
+
+int main(int argc, char** argv) {
+  const char* corpus_path = "test/parser/sourcestream-test-cases/jquery.js";
+  const char* json_path = nullptr;
+  int warmup = 3;
+  int repeat = 20;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--corpus") == 0) {
+      corpus_path = argv[i + 1];
+    } else if (strcmp(argv[i], "--warmup") == 0) {
+      warmup = std::max(0, atoi(argv[i + 1]));
+    } else if (strcmp(argv[i], "--repeat") == 0) {
+      repeat = std::max(1, atoi(argv[i + 1]));
+    } else if (strcmp(argv[i], "--json") == 0) {
+      json_path = argv[i + 1];
+    } else {
+      rasp::FPrintf(stderr, "usage: %s [--corpus path] [--warmup count] [--repeat count] [--json path]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  std::vector<Result> results;
+  for (const Corpus& corpus: CreateCorpus(corpus_path)) {
+    results.push_back(Run(corpus, warmup, repeat));
+  }
+  PrintResults(results);
+  if (json_path != nullptr) {
+    WriteJson(json_path, results, warmup, repeat);
+  }
+  return 0;
+}
@@ -40,11 +40,41 @@
       'sources': [
         './src/compiler-option.cc',
         './src/utils/os.cc',
+        './src/utils/cpu-feature.cc',
+        './src/utils/mapped-file.cc',
+        './src/utils/systeminfo.cc',
+        './src/utils/tls.cc',
+        './src/utils/regions.cc',
+        './src/parser/atom-table.cc',
+        './src/parser/byte-search.cc',
+        './src/parser/jsdoc-index.cc',
+        './src/parser/line-index.cc',
+        './src/parser/numeric-conversion.cc',
+        './src/parser/operator-table.cc',
+        './src/parser/parallel-scanner.cc',
+        './src/parser/power-of-ten-table.cc',
+        './src/parser/scan-pipeline.cc',
+        './src/parser/sourcestream.cc',
+        './src/parser/streaming-scanner.cc',
+        './src/parser/token-cache.cc',
         './src/parser/token.cc',
+        './src/parser/unicode-table.cc',
         './lib/gtest/gtest-all.cc',
+        './test/parser/byte-search-test.cc',
+        './test/parser/jsdoc-index-test.cc',
+        './test/parser/line-index-test.cc',
+        './test/parser/numeric-conversion-test.cc',
+        './test/parser/parallel-scanner-test.cc',
+        './test/parser/regional-utfstring-test.cc',
+        './test/parser/scan-pipeline-test.cc',
         './test/parser/scanner-keyword-scan-test.cc',
         './test/parser/scanner-operator-scan-test.cc',
         './test/parser/scanner-test.cc',
+        './test/parser/streaming-scanner-test.cc',
+        './test/parser/token-cache-test.cc',
+        './test/parser/token-stream-test.cc',
+        './test/parser/unicode-table-test.cc',
+        './test/parser/utfstring-test.cc',
         './test/test-main.cc',
       ],
       'xcode_settings': {
@@ -73,6 +103,8 @@
       'defines' : ['GTEST_HAS_RTTI=0', 'UNIT_TEST=1'],
       'sources': [
         './src/utils/os.cc',
+        './src/utils/cpu-feature.cc',
+        './src/parser/byte-search.cc',
         './src/parser/sourcestream.cc',
         './lib/gtest/gtest-all.cc',
         './test/parser/sourcestream-test.cc',
@@ -99,5 +131,56 @@
       'xcode_settings': {
       },
     },
+    {
+      'target_name': 'atom_table_test',
+      'product_name': 'AtomTableTest',
+      'type': 'executable',
+      'include_dirs' : ['./lib', '<(additional_include)'],
+      'defines' : ['GTEST_HAS_RTTI=0', 'UNIT_TEST=1'],
+      'sources': [
+        './src/utils/systeminfo.cc',
+        './src/utils/tls.cc',
+        './src/utils/os.cc',
+        './src/utils/regions.cc',
+        './src/parser/atom-table.cc',
+        './lib/gtest/gtest-all.cc',
+        './test/parser/atom-table-test.cc',
+        './test/test-main.cc'
+      ],
+      'xcode_settings': {
+      },
+    },
+    {
+      'target_name': 'scanner_bench',
+      'product_name': 'ScannerBench',
+      'type': 'executable',
+      'include_dirs' : ['./lib', '<(additional_include)'],
+      'sources': [
+        './src/compiler-option.cc',
+        './src/utils/os.cc',
+        './src/utils/cpu-feature.cc',
+        './src/utils/mapped-file.cc',
+        './src/utils/systeminfo.cc',
+        './src/utils/tls.cc',
+        './src/utils/regions.cc',
+        './src/parser/atom-table.cc',
+        './src/parser/byte-search.cc',
+        './src/parser/jsdoc-index.cc',
+        './src/parser/line-index.cc',
+        './src/parser/numeric-conversion.cc',
+        './src/parser/operator-table.cc',
+        './src/parser/parallel-scanner.cc',
+        './src/parser/power-of-ten-table.cc',
+        './src/parser/scan-pipeline.cc',
+        './src/parser/sourcestream.cc',
+        './src/parser/streaming-scanner.cc',
+        './src/parser/token-cache.cc',
+        './src/parser/token.cc',
+        './src/parser/unicode-table.cc',
+        './bench/scanner-bench.cc',
+      ],
+      'xcode_settings': {
+      },
+    },
   ] # targets
 }
@@ -89,6 +89,7 @@ def BuildConfig(args) :
   builder.CheckHeader(True, ["boost/preprocessor/repetition/repeat.hpp"], 'boost/preprocessor/repetition/repeat.hpp required.')
   builder.CheckHeader(True, ["boost/preprocessor/repetition/enum_params.hpp"], 'boost/preprocessor/repetition/enum_params.hpp required.')
   builder.CheckHeader(True, ["boost/preprocessor/repetition/enum_binary_params.hpp"], 'boost/preprocessor/repetition/enum_binary_params.hpp required.')
+  builder.CheckHeader(True, ["boost/preprocessor/repetition/enum.hpp"], 'boost/preprocessor/repetition/enum.hpp required.')
   builder.CheckHeader(True, ["boost/detail/atomic_count.hpp"], 'boost/preprocessor/repetition/repeat.hpp required.')
   builder.CheckStruct(False, [
     {
@@ -162,6 +163,21 @@ def BuildConfig(args) :
       '''
     }
   ], 'VM_MAKE_TAG is required.')
+  builder.CheckStruct(False, [
+    {
+      'name': '__builtin_cpu_supports',
+      'code': '''
+        bool Test() {__builtin_cpu_init();return __builtin_cpu_supports("avx2");}
+      '''
+    },
+    {
+      'name': '__cpuidex',
+      'header': ['intrin.h'],
+      'code': '''
+        void Test() {int info[4];__cpuidex(info, 7, 0);}
+      '''
+    }
+  ], 'cpuid is not found, simd is disabled.')
   builder.CheckStruct(True, [
     {
       'name': 'decltype',
@@ -51,6 +51,19 @@ class CompilerOption {
 };
 
 
+/**
+ * The compile time version of the LanguageModeUtil.
+ */
+template <LanguageMode kLanguageMode>
+struct LanguageModeTraits {
+  static const bool kOctalLiteralAllowed = kLanguageMode == LanguageMode::ES3;
+  static const bool kBinaryLiteralAllowed = kLanguageMode == LanguageMode::HARMONY;
+  static const bool kHarmony = kLanguageMode == LanguageMode::HARMONY;
+  static const bool kES5Strict = kLanguageMode == LanguageMode::ES5_STRICT;
+  static const bool kES3 = kLanguageMode == LanguageMode::ES3;
+};
+
+
 class LanguageModeUtil : private Static {
  public:
   RASP_INLINE static bool IsOctalLiteralAllowed(const CompilerOption& co) {
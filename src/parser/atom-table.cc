@@ -0,0 +1,114 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "atom-table.h"
+
+namespace rasp {
+
+const Atom AtomTable::kInvalidAtom;
+
+
+AtomTable::AtomTable(size_t bucket_count)
+    : regions_(64 KB),
+      next_atom_(kInvalidAtom + 1),
+      size_(0) {
+  size_t count = 1;
+  while (count < bucket_count) {
+    count <<= 1;
+  }
+  mask_ = static_cast<uint32_t>(count - 1);
+  buckets_ = regions_.NewWithTrailingSpace<Buckets>(sizeof(std::atomic<Entry*>) * count, count);
+}
+
+
+Atom AtomTable::Intern(const char* value, size_t length) {
+  uint32_t hash = Hash(value, length);
+  std::atomic<Entry*>& head = bucket(hash);
+  Entry* current = head.load(std::memory_order_acquire);
+  Entry* found = FindEntry(current, nullptr, hash, value, length);
+  if (found != nullptr) {
+    return found->atom;
+  }
+
+  Entry* entry = regions_.NewWithTrailingSpace<Entry>(
+      length, hash, next_atom_.fetch_add(1, std::memory_order_relaxed), length);
+  memcpy(entry->value(), value, length);
+  while (1) {
+    entry->next = current;
+    // The entry must be completely written before it is published.
+    if (head.compare_exchange_weak(current, entry, std::memory_order_release, std::memory_order_acquire)) {
+      size_.fetch_add(1, std::memory_order_relaxed);
+      return entry->atom;
+    }
+
+    // The other thread may insert the same identifier,
+    // so check the entries which are inserted after the previous head.
+    found = FindEntry(current, entry->next, hash, value, length);
+    if (found != nullptr) {
+      regions_.Dealloc(entry);
+      return found->atom;
+    }
+  }
+}
+
+
+Atom AtomTable::Find(const char* value, size_t length) const {
+  uint32_t hash = Hash(value, length);
+  Entry* found = FindEntry(bucket(hash).load(std::memory_order_acquire), nullptr, hash, value, length);
+  return found != nullptr? found->atom: kInvalidAtom;
+}
+
+
+AtomTable::Entry* AtomTable::FindEntry(Entry* begin, Entry* end, uint32_t hash, const char* value, size_t length) {
+  for (Entry* entry = begin; entry != end; entry = entry->next) {
+    if (entry->Equals(hash, value, length)) {
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+
+// FNV-1a
+uint32_t AtomTable::Hash(const char* value, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= static_cast<uint8_t>(value[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+
+namespace {
+// Initialized before the main, so the scanner threads need not to initialize the table.
+static AtomTable default_atom_table;
+}
+
+
+AtomTable* AtomTable::Default() {
+  return &default_atom_table;
+}
+
+}
@@ -0,0 +1,154 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_ATOM_TABLE_H_
+#define PARSER_ATOM_TABLE_H_
+
+#include <atomic>
+#include "../utils/regions.h"
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * The 32-bit id of the interned identifier.
+ * The same identifier bytes are always mapped to the same atom.
+ */
+typedef uint32_t Atom;
+
+
+/**
+ * The concurrent identifier table which maps the identifier bytes to the atom.
+ * The table is the fixed size buckets of the chains,
+ * and the chains are updated by the compare and swap of the bucket head,
+ * so the lookup never blocks even if the other threads insert the identifier.
+ * All entries are allocated from the Regions and released with the table.
+ */
+class AtomTable : private Uncopyable {
+ public:
+  static const Atom kInvalidAtom = 0;
+  
+  /**
+   * @param bucket_count The count of the buckets, which is rounded up to the power of 2.
+   */
+  explicit AtomTable(size_t bucket_count = 1 << 16);
+
+
+  /**
+   * Get the atom of the identifier, and register the identifier if not registered yet.
+   * The atom is unique and stable while the table is alive,
+   * but atoms are not always contiguous because the racing insertion may discard the reserved atom.
+   * @param value The utf-8 bytes of the identifier.
+   * @param length The byte length of the identifier.
+   */
+  Atom Intern(const char* value, size_t length);
+
+
+  /**
+   * Get the atom of the identifier.
+   * @returns The atom or kInvalidAtom if the identifier is not registered.
+   */
+  Atom Find(const char* value, size_t length) const;
+
+
+  /**
+   * The count of the registered identifiers.
+   */
+  RASP_INLINE size_t size() const {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+
+  /**
+   * The process-wide table which is shared by the all scanners.
+   */
+  static AtomTable* Default();
+  
+ private:
+  class Entry : public RegionalObject {
+   public:
+    Entry(uint32_t hash, Atom atom, size_t length)
+        : next(nullptr),
+          hash(hash),
+          atom(atom),
+          length(length) {}
+
+    // The identifier bytes are placed just after the entry.
+    RASP_INLINE char* value() {
+      return reinterpret_cast<char*>(this + 1);
+    }
+
+
+    RASP_INLINE bool Equals(uint32_t hash, const char* value, size_t length) {
+      return this->hash == hash && this->length == length &&
+          memcmp(this->value(), value, length) == 0;
+    }
+    
+    Entry* next;
+    uint32_t hash;
+    Atom atom;
+    size_t length;
+  };
+
+
+  class Buckets : public RegionalObject {
+   public:
+    explicit Buckets(size_t count) {
+      for (size_t i = 0; i < count; i++) {
+        new(&heads()[i]) std::atomic<Entry*>(nullptr);
+      }
+    }
+
+
+    // The heads are placed just after the buckets.
+    RASP_INLINE std::atomic<Entry*>* heads() {
+      return reinterpret_cast<std::atomic<Entry*>*>(this + 1);
+    }
+  };
+
+
+  RASP_INLINE std::atomic<Entry*>& bucket(uint32_t hash) const {
+    return buckets_->heads()[hash & mask_];
+  }
+
+  
+  /**
+   * Find the entry in the chain from the begin to the end.
+   */
+  static Entry* FindEntry(Entry* begin, Entry* end, uint32_t hash, const char* value, size_t length);
+
+  
+  static uint32_t Hash(const char* value, size_t length);
+  
+
+  Regions regions_;
+  Buckets* buckets_;
+  uint32_t mask_;
+  std::atomic<Atom> next_atom_;
+  std::atomic<size_t> size_;
+};
+
+}
+
+#endif
@@ -0,0 +1,700 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "byte-search.h"
+#include "../utils/cpu-feature.h"
+#if defined(RASP_X86)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace rasp {
+namespace {
+
+RASP_INLINE int CountTrailingZeros(uint32_t mask) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+
+RASP_INLINE bool IsWhiteSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\v' || c == '\f';
+}
+
+
+const char* FindLineTerminatorScalar(const char* it, const char* end) {
+  for (; it != end; ++it) {
+    if (*it == '\n' || *it == '\r' || *it == '\0') {
+      return it;
+    }
+  }
+  return end;
+}
+
+
+const char* FindMultiLineCommentEndScalar(const char* it, const char* end) {
+  for (; it != end; ++it) {
+    if (*it == '\0' || (*it == '*' && it + 1 != end && *(it + 1) == '/')) {
+      return it;
+    }
+  }
+  return end;
+}
+
+
+const char* SkipWhiteSpaceScalar(const char* it, const char* end) {
+  for (; it != end; ++it) {
+    if (!IsWhiteSpace(*it)) {
+      return it;
+    }
+  }
+  return end;
+}
+
+
+const char* FindStringLiteralSpecialScalar(const char* it, const char* end, char quote) {
+  for (; it != end; ++it) {
+    char c = *it;
+    if (c == quote || c == '\\' || c == '\n' || c == '\r' || c == '\0' ||
+        (static_cast<uint8_t>(c) & 0x80) != 0) {
+      return it;
+    }
+  }
+  return end;
+}
+
+
+const char* FindNonAsciiScalar(const char* it, const char* end) {
+  for (; it != end; ++it) {
+    if ((static_cast<uint8_t>(*it) & 0x80) != 0) {
+      return it;
+    }
+  }
+  return end;
+}
+
+
+/**
+ * Return the byte count of the utf-8 sequence at the it, or 0 if the sequence is invalid.
+ * The overlong forms, the surrogates and the code points over U+10FFFF are invalid.
+ */
+size_t ValidSequenceLength(const char* it, const char* end) {
+  uint8_t c = static_cast<uint8_t>(*it);
+  if (c < 0x80) {
+    return 1;
+  }
+  size_t length;
+  uint8_t low = 0x80;
+  uint8_t high = 0xBF;
+  if (c >= 0xC2 && c <= 0xDF) {
+    length = 2;
+  } else if (c >= 0xE0 && c <= 0xEF) {
+    length = 3;
+    low = c == 0xE0? 0xA0: low;
+    high = c == 0xED? 0x9F: high;
+  } else if (c >= 0xF0 && c <= 0xF4) {
+    length = 4;
+    low = c == 0xF0? 0x90: low;
+    high = c == 0xF4? 0x8F: high;
+  } else {
+    return 0;
+  }
+
+  if (static_cast<size_t>(end - it) < length) {
+    return 0;
+  }
+  uint8_t c1 = static_cast<uint8_t>(it[1]);
+  if (c1 < low || c1 > high) {
+    return 0;
+  }
+  for (size_t i = 2; i < length; i++) {
+    if ((static_cast<uint8_t>(it[i]) & 0xC0) != 0x80) {
+      return 0;
+    }
+  }
+  return length;
+}
+
+
+// Skip the ascii bytes by the find_non_ascii, and validate the non ascii sequences one by one.
+template <const char* (*find_non_ascii)(const char*, const char*)>
+const char* FindInvalidUtf8(const char* it, const char* end) {
+  while (1) {
+    it = find_non_ascii(it, end);
+    if (it == end) {
+      return end;
+    }
+    size_t length = ValidSequenceLength(it, end);
+    if (length == 0) {
+      return it;
+    }
+    it += length;
+  }
+}
+
+
+const char* FindInvalidUtf8Scalar(const char* it, const char* end) {
+  return FindInvalidUtf8<FindNonAsciiScalar>(it, end);
+}
+
+
+const UC16 kReplacementCharacter = 0xFFFD;
+
+/**
+ * Convert the one non ascii sequence at the it and return the next position.
+ * The characters over U+FFFF are written as the surrogate pair.
+ */
+const char* ConvertSequence(const char* it, const char* end, UC16** out) {
+  size_t length = ValidSequenceLength(it, end);
+  if (length == 0) {
+    *(*out)++ = kReplacementCharacter;
+    return it + 1;
+  }
+  UC32 uc = utf8::DecodeUnchecked(it, length);
+  if (utf16::IsSurrogatePairUC32(uc)) {
+    *(*out)++ = utf16::ToHighSurrogateUC32(uc);
+    *(*out)++ = utf16::ToLowSurrogateUC32(uc);
+  } else {
+    *(*out)++ = static_cast<UC16>(uc);
+  }
+  return it + length;
+}
+
+
+UC16* ConvertUtf8ToUtf16Scalar(const char* it, const char* end, UC16* out) {
+  while (it != end) {
+    uint8_t c = static_cast<uint8_t>(*it);
+    if (c < 0x80) {
+      *out++ = c;
+      ++it;
+    } else {
+      it = ConvertSequence(it, end, &out);
+    }
+  }
+  return out;
+}
+
+
+#if defined(RASP_X86)
+
+RASP_TARGET("sse2")
+const char* FindLineTerminatorSSE2(const char* it, const char* end) {
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i nul = _mm_setzero_si128();
+  for (; end - it >= 16; it += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr)),
+                             _mm_cmpeq_epi8(v, nul));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return FindLineTerminatorScalar(it, end);
+}
+
+
+RASP_TARGET("sse2")
+const char* FindMultiLineCommentEndSSE2(const char* it, const char* end) {
+  const __m128i asterisk = _mm_set1_epi8('*');
+  const __m128i slash = _mm_set1_epi8('/');
+  const __m128i nul = _mm_setzero_si128();
+  // Compare the '*' and the next '/' at once, so the next block must be readable.
+  for (; end - it >= 17; it += 16) {
+    __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+    __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 1));
+    __m128i m = _mm_or_si128(_mm_and_si128(_mm_cmpeq_epi8(v0, asterisk), _mm_cmpeq_epi8(v1, slash)),
+                             _mm_cmpeq_epi8(v0, nul));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return FindMultiLineCommentEndScalar(it, end);
+}
+
+
+RASP_TARGET("sse2")
+const char* SkipWhiteSpaceSSE2(const char* it, const char* end) {
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i vtab = _mm_set1_epi8('\v');
+  const __m128i ff = _mm_set1_epi8('\f');
+  for (; end - it >= 16; it += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+                             _mm_or_si128(_mm_cmpeq_epi8(v, vtab), _mm_cmpeq_epi8(v, ff)));
+    uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(m)) & 0xFFFF;
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return SkipWhiteSpaceScalar(it, end);
+}
+
+
+RASP_TARGET("sse2")
+const char* FindStringLiteralSpecialSSE2(const char* it, const char* end, char quote) {
+  const __m128i q = _mm_set1_epi8(quote);
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i nul = _mm_setzero_si128();
+  for (; end - it >= 16; it += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, q), _mm_cmpeq_epi8(v, backslash)),
+                             _mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr)));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, nul));
+    // The most significant bit of the non ascii byte is set.
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m) | _mm_movemask_epi8(v));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return FindStringLiteralSpecialScalar(it, end, quote);
+}
+
+
+RASP_TARGET("sse2")
+const char* FindNonAsciiSSE2(const char* it, const char* end) {
+  for (; end - it >= 16; it += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(v));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return FindNonAsciiScalar(it, end);
+}
+
+
+// The SSE2 has no byte shuffle, so only the ascii bytes are skipped by the SIMD.
+const char* FindInvalidUtf8SSE2(const char* it, const char* end) {
+  return FindInvalidUtf8<FindNonAsciiSSE2>(it, end);
+}
+
+
+// The whole block is widened, and the code units after the first non ascii byte are overwritten.
+// The out has a room for the block, because the utf-16 code units are not more than the utf-8 bytes.
+RASP_TARGET("sse2")
+UC16* ConvertUtf8ToUtf16SSE2(const char* it, const char* end, UC16* out) {
+  const __m128i zero = _mm_setzero_si128();
+  while (end - it >= 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(v, zero));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(v));
+    if (mask == 0) {
+      it += 16;
+      out += 16;
+      continue;
+    }
+    int ascii = CountTrailingZeros(mask);
+    out += ascii;
+    it = ConvertSequence(it + ascii, end, &out);
+  }
+  return ConvertUtf8ToUtf16Scalar(it, end, out);
+}
+
+
+RASP_TARGET("avx2")
+const char* FindLineTerminatorAVX2(const char* it, const char* end) {
+  const __m256i lf = _mm256_set1_epi8('\n');
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i nul = _mm256_setzero_si256();
+  for (; end - it >= 32; it += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+    __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, lf), _mm256_cmpeq_epi8(v, cr)),
+                                _mm256_cmpeq_epi8(v, nul));
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return FindLineTerminatorSSE2(it, end);
+}
+
+
+RASP_TARGET("avx2")
+const char* FindMultiLineCommentEndAVX2(const char* it, const char* end) {
+  const __m256i asterisk = _mm256_set1_epi8('*');
+  const __m256i slash = _mm256_set1_epi8('/');
+  const __m256i nul = _mm256_setzero_si256();
+  for (; end - it >= 33; it += 32) {
+    __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+    __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it + 1));
+    __m256i m = _mm256_or_si256(
+        _mm256_and_si256(_mm256_cmpeq_epi8(v0, asterisk), _mm256_cmpeq_epi8(v1, slash)),
+        _mm256_cmpeq_epi8(v0, nul));
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return FindMultiLineCommentEndSSE2(it, end);
+}
+
+
+RASP_TARGET("avx2")
+const char* SkipWhiteSpaceAVX2(const char* it, const char* end) {
+  const __m256i space = _mm256_set1_epi8(' ');
+  const __m256i tab = _mm256_set1_epi8('\t');
+  const __m256i vtab = _mm256_set1_epi8('\v');
+  const __m256i ff = _mm256_set1_epi8('\f');
+  for (; end - it >= 32; it += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+    __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)),
+                                _mm256_or_si256(_mm256_cmpeq_epi8(v, vtab), _mm256_cmpeq_epi8(v, ff)));
+    uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(m));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return SkipWhiteSpaceSSE2(it, end);
+}
+
+RASP_TARGET("avx2")
+const char* FindStringLiteralSpecialAVX2(const char* it, const char* end, char quote) {
+  const __m256i q = _mm256_set1_epi8(quote);
+  const __m256i backslash = _mm256_set1_epi8('\\');
+  const __m256i lf = _mm256_set1_epi8('\n');
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i nul = _mm256_setzero_si256();
+  for (; end - it >= 32; it += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+    __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, q), _mm256_cmpeq_epi8(v, backslash)),
+                                _mm256_or_si256(_mm256_cmpeq_epi8(v, lf), _mm256_cmpeq_epi8(v, cr)));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, nul));
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m) | _mm256_movemask_epi8(v));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return FindStringLiteralSpecialSSE2(it, end, quote);
+}
+
+
+RASP_TARGET("avx2")
+const char* FindNonAsciiAVX2(const char* it, const char* end) {
+  for (; end - it >= 32; it += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(v));
+    if (mask != 0) {
+      return it + CountTrailingZeros(mask);
+    }
+  }
+  return FindNonAsciiSSE2(it, end);
+}
+
+
+/**
+ * Return the front of the sequence which may be continued to the block,
+ * the block is at most 3 bytes after the front of the sequence.
+ * The bytes before the sequence must be validated.
+ */
+const char* SequenceFront(const char* begin, const char* block) {
+  for (int i = 1; i <= 3 && block - i >= begin; i++) {
+    if ((static_cast<uint8_t>(block[-i]) & 0xC0) != 0x80) {
+      return block - i;
+    }
+  }
+  return block;
+}
+
+
+#define RASP_NIBBLE_TABLE(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+/**
+ * Validate the 32 bytes at once by the lookup algorithm of the John Keiser and the Daniel Lemire.
+ * The errors of the each byte pair are looked up from the high and the low nibble of the first byte
+ * and the high nibble of the second byte, and the error is found if the all lookups have the same bit.
+ * The block which has the error is validated again by the scalar to find the front of the error.
+ */
+RASP_TARGET("avx2")
+const char* FindInvalidUtf8AVX2(const char* begin, const char* end) {
+  // 11______ 0_______ or 11______ 11______
+  const char kTooShort = 1 << 0;
+  // 0_______ 10______
+  const char kTooLong = 1 << 1;
+  // 11100000 100_____
+  const char kOverlong3 = 1 << 2;
+  // 11110100 1001____, 11110100 101_____, 11110101 ________ or 1111011_ ________
+  const char kTooLarge = 1 << 3;
+  // 11101101 101_____
+  const char kSurrogate = 1 << 4;
+  // 1100000_ 10______
+  const char kOverlong2 = 1 << 5;
+  // 11110101 1000____, 1111011_ 1000____ or 11111___ 1000____
+  const char kTooLarge1000 = 1 << 6;
+  // 11110000 1000____
+  const char kOverlong4 = 1 << 6;
+  // 10______ 10______
+  const char kTwoConts = static_cast<char>(1 << 7);
+  const char kCarry = kTooShort | kTooLong | kTwoConts;
+
+  const __m256i byte_1_high_table = RASP_NIBBLE_TABLE(
+      kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+      kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+      kTooShort | kOverlong2,
+      kTooShort,
+      kTooShort | kOverlong3 | kSurrogate,
+      kTooShort | kTooLarge | kTooLarge1000 | kOverlong4);
+  const __m256i byte_1_low_table = RASP_NIBBLE_TABLE(
+      kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+      kCarry | kOverlong2,
+      kCarry,
+      kCarry,
+      kCarry | kTooLarge,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000);
+  const __m256i byte_2_high_table = RASP_NIBBLE_TABLE(
+      kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      kTooShort, kTooShort, kTooShort, kTooShort);
+  const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+  const __m256i third_byte = _mm256_set1_epi8(0xE0 - 0x80);
+  const __m256i fourth_byte = _mm256_set1_epi8(0xF0 - 0x80);
+  const __m256i high_bit = _mm256_set1_epi8(static_cast<char>(0x80));
+  // The lead bytes in the last 3 bytes which need the continuation bytes in the next block.
+  const __m256i incomplete_max = _mm256_setr_epi8(
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+
+  __m256i prev_input = _mm256_setzero_si256();
+  __m256i prev_incomplete = _mm256_setzero_si256();
+  const char* it = begin;
+  for (; end - it >= 32; it += 32) {
+    __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+    if (_mm256_movemask_epi8(input) == 0) {
+      if (!_mm256_testz_si256(prev_incomplete, prev_incomplete)) {
+        return FindInvalidUtf8SSE2(SequenceFront(begin, it), end);
+      }
+      prev_input = input;
+      continue;
+    }
+
+    // The bytes before the each byte, which are continued from the previous block.
+    __m256i carried = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(input, carried, 15);
+    __m256i prev2 = _mm256_alignr_epi8(input, carried, 14);
+    __m256i prev3 = _mm256_alignr_epi8(input, carried, 13);
+    __m256i byte_1_high = _mm256_shuffle_epi8(
+        byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask));
+    __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, nibble_mask));
+    __m256i byte_2_high = _mm256_shuffle_epi8(
+        byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask));
+    __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+    
+    // The third and the fourth byte of the sequence must be the continuation byte.
+    __m256i must_be_continuation = _mm256_and_si256(
+        _mm256_or_si256(_mm256_subs_epu8(prev2, third_byte), _mm256_subs_epu8(prev3, fourth_byte)),
+        high_bit);
+    __m256i error = _mm256_xor_si256(must_be_continuation, special_cases);
+    if (!_mm256_testz_si256(error, error)) {
+      return FindInvalidUtf8SSE2(SequenceFront(begin, it), end);
+    }
+    prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+    prev_input = input;
+  }
+  return FindInvalidUtf8SSE2(SequenceFront(begin, it), end);
+}
+
+#undef RASP_NIBBLE_TABLE
+
+
+RASP_TARGET("avx2")
+UC16* ConvertUtf8ToUtf16AVX2(const char* it, const char* end, UC16* out) {
+  while (end - it >= 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                        _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                        _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(v));
+    if (mask == 0) {
+      it += 32;
+      out += 32;
+      continue;
+    }
+    int ascii = CountTrailingZeros(mask);
+    out += ascii;
+    it = ConvertSequence(it + ascii, end, &out);
+  }
+  return ConvertUtf8ToUtf16SSE2(it, end, out);
+}
+
+#endif
+
+
+// The kernels are resolved at the first call
+// if the kernels are called before the static initialization of this file.
+const char* ResolveFindLineTerminator(const char* begin, const char* end) {
+  ByteSearch::instruction_set();
+  return ByteSearch::FindLineTerminator(begin, end);
+}
+
+
+const char* ResolveFindMultiLineCommentEnd(const char* begin, const char* end) {
+  ByteSearch::instruction_set();
+  return ByteSearch::FindMultiLineCommentEnd(begin, end);
+}
+
+
+const char* ResolveSkipWhiteSpace(const char* begin, const char* end) {
+  ByteSearch::instruction_set();
+  return ByteSearch::SkipWhiteSpace(begin, end);
+}
+
+
+const char* ResolveFindStringLiteralSpecial(const char* begin, const char* end, char quote) {
+  ByteSearch::instruction_set();
+  return ByteSearch::FindStringLiteralSpecial(begin, end, quote);
+}
+
+
+const char* ResolveFindNonAscii(const char* begin, const char* end) {
+  ByteSearch::instruction_set();
+  return ByteSearch::FindNonAscii(begin, end);
+}
+
+
+const char* ResolveFindInvalidUtf8(const char* begin, const char* end) {
+  ByteSearch::instruction_set();
+  return ByteSearch::FindInvalidUtf8(begin, end);
+}
+
+
+UC16* ResolveConvertUtf8ToUtf16(const char* begin, const char* end, UC16* out) {
+  ByteSearch::instruction_set();
+  return ByteSearch::ConvertUtf8ToUtf16(begin, end, out);
+}
+
+} // namespace
+
+
+bool ByteSearch::Use(InstructionSet instruction_set) {
+  switch (instruction_set) {
+#if defined(RASP_X86)
+    case InstructionSet::AVX2:
+      if (!CpuFeature::HasAVX2()) {
+        return false;
+      }
+      find_line_terminator_ = FindLineTerminatorAVX2;
+      find_multi_line_comment_end_ = FindMultiLineCommentEndAVX2;
+      skip_white_space_ = SkipWhiteSpaceAVX2;
+      find_string_literal_special_ = FindStringLiteralSpecialAVX2;
+      find_non_ascii_ = FindNonAsciiAVX2;
+      find_invalid_utf8_ = FindInvalidUtf8AVX2;
+      convert_utf8_to_utf16_ = ConvertUtf8ToUtf16AVX2;
+      break;
+    case InstructionSet::SSE2:
+      if (!CpuFeature::HasSSE2()) {
+        return false;
+      }
+      find_line_terminator_ = FindLineTerminatorSSE2;
+      find_multi_line_comment_end_ = FindMultiLineCommentEndSSE2;
+      skip_white_space_ = SkipWhiteSpaceSSE2;
+      find_string_literal_special_ = FindStringLiteralSpecialSSE2;
+      find_non_ascii_ = FindNonAsciiSSE2;
+      find_invalid_utf8_ = FindInvalidUtf8SSE2;
+      convert_utf8_to_utf16_ = ConvertUtf8ToUtf16SSE2;
+      break;
+#endif
+    case InstructionSet::SCALAR:
+      find_line_terminator_ = FindLineTerminatorScalar;
+      find_multi_line_comment_end_ = FindMultiLineCommentEndScalar;
+      skip_white_space_ = SkipWhiteSpaceScalar;
+      find_string_literal_special_ = FindStringLiteralSpecialScalar;
+      find_non_ascii_ = FindNonAsciiScalar;
+      find_invalid_utf8_ = FindInvalidUtf8Scalar;
+      convert_utf8_to_utf16_ = ConvertUtf8ToUtf16Scalar;
+      break;
+    default:
+      return false;
+  }
+  instruction_set_ = instruction_set;
+  return true;
+}
+
+
+ByteSearch::InstructionSet ByteSearch::instruction_set() {
+  if (instruction_set_ == InstructionSet::SCALAR &&
+      find_line_terminator_ == ResolveFindLineTerminator) {
+    Initialize();
+  }
+  return instruction_set_;
+}
+
+
+void ByteSearch::Initialize() {
+  if (!Use(InstructionSet::AVX2) && !Use(InstructionSet::SSE2)) {
+    Use(InstructionSet::SCALAR);
+  }
+}
+
+
+ByteSearch::Kernel ByteSearch::find_line_terminator_ = ResolveFindLineTerminator;
+ByteSearch::Kernel ByteSearch::find_multi_line_comment_end_ = ResolveFindMultiLineCommentEnd;
+ByteSearch::Kernel ByteSearch::skip_white_space_ = ResolveSkipWhiteSpace;
+ByteSearch::QuoteKernel ByteSearch::find_string_literal_special_ = ResolveFindStringLiteralSpecial;
+ByteSearch::Kernel ByteSearch::find_non_ascii_ = ResolveFindNonAscii;
+ByteSearch::Kernel ByteSearch::find_invalid_utf8_ = ResolveFindInvalidUtf8;
+ByteSearch::ConvertKernel ByteSearch::convert_utf8_to_utf16_ = ResolveConvertUtf8ToUtf16;
+ByteSearch::InstructionSet ByteSearch::instruction_set_ = ByteSearch::InstructionSet::SCALAR;
+
+
+namespace {
+// Select the kernels before the main, so the kernels are not changed by the other threads.
+class Initializer {
+ public:
+  Initializer() {
+    ByteSearch::instruction_set();
+  }
+};
+
+static Initializer initializer;
+}
+
+}
@@ -0,0 +1,153 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_BYTE_SEARCH_H_
+#define PARSER_BYTE_SEARCH_H_
+
+#include "../utils/utils.h"
+#include "../utils/unicode.h"
+
+namespace rasp {
+
+/**
+ * The byte search kernels for the raw utf-8 buffer.
+ * The kernels scan 16 or 32 bytes at once by SSE2 or AVX2,
+ * which is selected by the cpu feature at the program startup.
+ * All kernels return the end if the target is not found.
+ */
+class ByteSearch : private Static {
+ public:
+  enum class InstructionSet: uint8_t {
+    SCALAR,
+    SSE2,
+    AVX2
+  };
+  
+  
+  /**
+   * Find the first '\n', '\r' or '\0' in [begin, end).
+   */
+  RASP_INLINE static const char* FindLineTerminator(const char* begin, const char* end) {
+    return find_line_terminator_(begin, end);
+  }
+
+
+  /**
+   * Find the '*' of the first '*' '/' pair or the first '\0' in [begin, end).
+   */
+  RASP_INLINE static const char* FindMultiLineCommentEnd(const char* begin, const char* end) {
+    return find_multi_line_comment_end_(begin, end);
+  }
+
+
+  /**
+   * Find the first byte which is not the tab, vertical tab, form feed or space in [begin, end).
+   */
+  RASP_INLINE static const char* SkipWhiteSpace(const char* begin, const char* end) {
+    return skip_white_space_(begin, end);
+  }
+
+
+  /**
+   * Find the quote, '\\', '\n', '\r', '\0' or the non ascii byte in [begin, end).
+   * The string literal can be skipped until these bytes without decoding.
+   */
+  RASP_INLINE static const char* FindStringLiteralSpecial(const char* begin, const char* end, char quote) {
+    return find_string_literal_special_(begin, end, quote);
+  }
+
+
+  /**
+   * Find the first non ascii byte in [begin, end).
+   */
+  RASP_INLINE static const char* FindNonAscii(const char* begin, const char* end) {
+    return find_non_ascii_(begin, end);
+  }
+
+
+  /**
+   * Find the front of the first invalid utf-8 sequence in [begin, end).
+   * The overlong forms, the surrogates, the code points over U+10FFFF
+   * and the truncated sequences are invalid.
+   * The AVX2 kernel validates 32 bytes at once by the table lookup.
+   */
+  RASP_INLINE static const char* FindInvalidUtf8(const char* begin, const char* end) {
+    return find_invalid_utf8_(begin, end);
+  }
+
+
+  /**
+   * Convert the utf-8 sequence [begin, end) to utf-16 and write it to the out.
+   * The out must have a room for the (end - begin) code units.
+   * The ascii blocks are widened by the SIMD, and the other characters are converted one by one.
+   * The invalid sequence is replaced with U+FFFD.
+   * @returns The end of the written code units.
+   */
+  RASP_INLINE static UC16* ConvertUtf8ToUtf16(const char* begin, const char* end, UC16* out) {
+    return convert_utf8_to_utf16_(begin, end, out);
+  }
+
+
+  /**
+   * Count the utf-8 characters in [begin, end).
+   * The invalid byte is counted as one character.
+   */
+  static size_t CountCharacters(const char* begin, const char* end) {
+    size_t count = 0;
+    for (; begin != end; ++begin) {
+      count += (static_cast<uint8_t>(*begin) & 0xC0) != 0x80;
+    }
+    return count;
+  }
+
+
+  /**
+   * Change the kernels to the specified instruction set.
+   * @returns false if the cpu does not support the instruction set.
+   */
+  static bool Use(InstructionSet instruction_set);
+
+
+  static InstructionSet instruction_set();
+
+ private:
+  typedef const char* (*Kernel)(const char* begin, const char* end);
+  typedef const char* (*QuoteKernel)(const char* begin, const char* end, char quote);
+  typedef UC16* (*ConvertKernel)(const char* begin, const char* end, UC16* out);
+
+  static void Initialize();
+  
+  static Kernel find_line_terminator_;
+  static Kernel find_multi_line_comment_end_;
+  static Kernel skip_white_space_;
+  static QuoteKernel find_string_literal_special_;
+  static Kernel find_non_ascii_;
+  static Kernel find_invalid_utf8_;
+  static ConvertKernel convert_utf8_to_utf16_;
+  static InstructionSet instruction_set_;
+};
+
+}
+
+#endif
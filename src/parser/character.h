@@ -27,6 +27,7 @@
 #define PARSER_CHRACTER_H_
 
 #include "uchar.h"
+#include "unicode-table.h"
 #include "../utils/utils.h"
 #include "../utils/unicode.h"
 
@@ -41,102 +42,114 @@ class Character : private Static {
     NONE
   };
   
-  static bool IsWhiteSpace(const UChar& uchar, const UChar& lookahead) {
-    return uchar.IsAscii() &&
-        (uchar == unicode::u8(0x09) ||
-         uchar == unicode::u8(0x0b) ||
-         uchar == unicode::u8(0x0c) ||
-         uchar == unicode::u8(0x20) ||
-         uchar == unicode::u8(255) ||
-         GetLineBreakType(uchar, lookahead) != LineBreakType::NONE ||
-         uchar == unicode::u32(0x2028) ||
-         uchar == unicode::u32(0x1680) ||
-         uchar == unicode::u32(0x180E) ||
-         (uchar >= unicode::u32(0x2000) && uchar <= unicode::u32(0x200A)) ||
-         uchar == unicode::u32(0x2028) ||
-         uchar == unicode::u32(0x2029) ||
-         uchar == unicode::u32(0x202F) ||
-         uchar == unicode::u32(0x205F) ||
-         uchar == unicode::u32(0x3000));
+  /**
+   * The non ascii white spaces and line terminators are looked up from the UnicodeTable.
+   */
+  static bool IsWhiteSpace(UChar uchar, UChar lookahead) {
+    if (uchar.IsAscii()) {
+      return uchar == unicode::u8(0x09) ||
+          uchar == unicode::u8(0x0b) ||
+          uchar == unicode::u8(0x0c) ||
+          uchar == unicode::u8(0x20) ||
+          GetLineBreakType(uchar, lookahead) != LineBreakType::NONE;
+    }
+    return UnicodeTable::IsWhiteSpace(uchar.ToUC32());
   }
 
 
-  RASP_INLINE static bool IsPuncture(const UChar& uchar) {
-    return GetCharType(uchar.ToUC8Ascii()) == CharType::PUNCTURES;
+  /**
+   * The LINE SEPARATOR and the PARAGRAPH SEPARATOR,
+   * which terminate the line like the LF but are not counted as the line break.
+   */
+  RASP_INLINE static bool IsUnicodeLineTerminator(UChar uchar) {
+    return uchar == unicode::u32(0x2028) || uchar == unicode::u32(0x2029);
   }
-  
 
-  RASP_INLINE static bool IsOperatorStart(const UChar& uchar) {
-    return GetCharType(uchar.ToUC8Ascii()) == CharType::OPERATORS;
+
+  RASP_INLINE static bool IsOperatorStart(UChar uchar) {
+    return GetCharType(uchar.ToUC32()) == CharType::OPERATORS;
   }
 
 
-  static bool IsDigitStart(const UChar& uchar, const UChar& lookahead) {
+  static bool IsDigitStart(UChar uchar, UChar lookahead) {
     return (uchar == unicode::u8('.') && lookahead.IsAscii() && IsNumericLiteral(lookahead)) ||
         (uchar == unicode::u8('0') && lookahead.IsAscii() && lookahead == unicode::u8('x')) ||
         IsNumericLiteral(uchar);
   }
 
   
-  static bool IsStringLiteralStart(const UChar& uchar) {
-    return GetCharType(uchar.ToUC8Ascii()) == CharType::QUOTE;
+  static bool IsStringLiteralStart(UChar uchar) {
+    return GetCharType(uchar.ToUC32()) == CharType::QUOTE;
   }
 
   
-  static bool IsHexRange(const UChar& uchar) {
+  static bool IsHexRange(UChar uchar) {
     return IsNumericLiteral(uchar) ||
         (uchar >= unicode::u8('a') && uchar <= unicode::u8('f')) ||
         (uchar >= unicode::u8('A') && uchar <= unicode::u8('F'));
   }
 
 
-  RASP_INLINE static bool IsIdentifierStart(const UChar& uchar) {
-    return IsIdentifierStartChar(uchar);
+  RASP_INLINE static bool IsIdentifierStart(UChar uchar) {
+    return IsIdentifierStartChar(uchar.ToUC32());
   }
 
 
-  template <typename T>
-  static bool IsIdentifierStartChar(T uchar) {
-    return GetCharType(static_cast<UC8>(uchar)) == CharType::IDENTIFIER;
+  /**
+   * The ascii characters are checked by the character table,
+   * and the others are looked up from the UnicodeTable.
+   */
+  RASP_INLINE static bool IsIdentifierStartChar(UC32 c) {
+    return utf8::IsAscii(c)?
+        GetCharType(c) == CharType::IDENTIFIER: UnicodeTable::IsIdentifierStart(c);
+  }
+
+
+  RASP_INLINE static bool IsIdentifierPartChar(UC32 c) {
+    if (utf8::IsAscii(c)) {
+      CharType type = GetCharType(c);
+      return type == CharType::IDENTIFIER || type == CharType::NUMERIC;
+    }
+    return UnicodeTable::IsIdentifierPart(c);
   }
 
 
-  RASP_INLINE static bool IsUnicodeEscapeSequenceStart(const UChar& uchar, const UChar& lookahead) {
+  RASP_INLINE static bool IsUnicodeEscapeSequenceStart(UChar uchar, UChar lookahead) {
     return uchar == unicode::u8('\\') && lookahead == unicode::u8('u');
   }
 
 
-  RASP_INLINE static bool IsInIdentifierRange(const UChar& uchar) {
-    return IsIdentifierStart(uchar) || IsNumericLiteral(uchar);
+  RASP_INLINE static bool IsInIdentifierRange(UChar uchar) {
+    return IsIdentifierPartChar(uchar.ToUC32());
   }
 
   
-  RASP_INLINE static bool IsNumericLiteral(const UChar& uchar) {
-    return GetCharType(uchar.ToUC8Ascii()) == CharType::NUMERIC;
+  RASP_INLINE static bool IsNumericLiteral(UChar uchar) {
+    return GetCharType(uchar.ToUC32()) == CharType::NUMERIC;
   }
 
 
-  RASP_INLINE static bool IsBinaryCharacter(const UChar& uchar) {
+  RASP_INLINE static bool IsBinaryCharacter(UChar uchar) {
     return uchar == unicode::u8('0') || uchar == unicode::u8('1');
   }
 
 
-  RASP_INLINE static bool IsSingleLineCommentStart(const UChar& uchar, const UChar& lookahead) {
+  RASP_INLINE static bool IsSingleLineCommentStart(UChar uchar, UChar lookahead) {
     return uchar == unicode::u8('/') && lookahead == unicode::u8('/');
   }
 
 
-  RASP_INLINE static bool IsMultiLineCommentStart(const UChar& uchar, const UChar& lookahead) {
+  RASP_INLINE static bool IsMultiLineCommentStart(UChar uchar, UChar lookahead) {
     return uchar == unicode::u8('/') && lookahead == unicode::u8('*');
   }
 
 
-  RASP_INLINE static bool IsMultiLineCommentEnd(const UChar& uchar, const UChar& lookahead) {
+  RASP_INLINE static bool IsMultiLineCommentEnd(UChar uchar, UChar lookahead) {
     return uchar == unicode::u8('*') && lookahead == unicode::u8('/');
   }
 
 
-  static LineBreakType GetLineBreakType(const UChar& uchar, const UChar& lookahead) {
+  static LineBreakType GetLineBreakType(UChar uchar, UChar lookahead) {
     if (uchar == unicode::u8('\n')) {
       return LineBreakType::LF;
     }
@@ -152,7 +165,6 @@ class Character : private Static {
  private:
   enum class CharType: uint8_t {
     OPERATORS,
-    PUNCTURES,
     IDENTIFIER,
     QUOTE,
     NUMERIC,
@@ -160,7 +172,7 @@ class Character : private Static {
   };
 
   
-  static CharType GetCharType(UC8 ch) {
+  static CharType GetCharType(UC32 ch) {
     static const CharType kChars[] = {
       CharType::OTHER,// 0
       CharType::OTHER,// 1
@@ -202,13 +214,13 @@ class Character : private Static {
       CharType::OPERATORS,// 37 %
       CharType::OPERATORS,// 38 &
       CharType::QUOTE,// 39 '
-      CharType::PUNCTURES,// 40 (
-      CharType::PUNCTURES,// 41 )
+      CharType::OPERATORS,// 40 (
+      CharType::OPERATORS,// 41 )
       CharType::OPERATORS,// 42 *
       CharType::OPERATORS,// 43 +
       CharType::OTHER,// 44 ,
       CharType::OPERATORS,// 45 -
-      CharType::OTHER,// 46 .
+      CharType::OPERATORS,// 46 .
       CharType::OPERATORS,// 47 /
       CharType::NUMERIC,// 48 0
       CharType::NUMERIC,// 49 1
@@ -220,12 +232,12 @@ class Character : private Static {
       CharType::NUMERIC,// 55 7
       CharType::NUMERIC,// 56 8
       CharType::NUMERIC,// 57 9
-      CharType::PUNCTURES,// 58 :
+      CharType::OPERATORS,// 58 :
       CharType::OTHER,// 59 ;
       CharType::OPERATORS,// 60 <
       CharType::OPERATORS,// 61 =
       CharType::OPERATORS,// 62 >
-      CharType::PUNCTURES,// 63 ?
+      CharType::OPERATORS,// 63 ?
       CharType::OTHER,// 64 @
       CharType::IDENTIFIER,// 65 A
       CharType::IDENTIFIER,// 66 B
@@ -253,9 +265,9 @@ class Character : private Static {
       CharType::IDENTIFIER,// 88 X
       CharType::IDENTIFIER,// 89 Y
       CharType::IDENTIFIER,// 90 Z
-      CharType::PUNCTURES,// 91 [
+      CharType::OPERATORS,// 91 [
       CharType::OTHER,// 92 BACK_SLASH
-      CharType::PUNCTURES,// 93 ]
+      CharType::OPERATORS,// 93 ]
       CharType::OPERATORS,// 94 ^
       CharType::IDENTIFIER,// 95 _
       CharType::OTHER,// 96 `
@@ -285,9 +297,9 @@ class Character : private Static {
       CharType::IDENTIFIER,// 120 x
       CharType::IDENTIFIER,// 121 y
       CharType::IDENTIFIER,// 122 z
-      CharType::PUNCTURES,// 123 {
+      CharType::OPERATORS,// 123 {
       CharType::OPERATORS,// 124 |
-      CharType::PUNCTURES,// 125 }
+      CharType::OPERATORS,// 125 }
       CharType::OPERATORS,// 126 ~
       CharType::OTHER // 127 DEL
     };
@@ -0,0 +1,155 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_CODE_UNIT_ITERATOR_ADAPTER_H_
+#define PARSER_CODE_UNIT_ITERATOR_ADAPTER_H_
+
+#include <stddef.h>
+#include <iterator>
+#include "../utils/utils.h"
+#include "../utils/unicode.h"
+#include "./uchar.h"
+
+namespace rasp {
+
+/**
+ * The decoder of the one character from the code units.
+ * The UC8 is the latin-1 byte and the UC16 is the utf-16 code unit in the native byte order.
+ */
+template <typename CodeUnit>
+class CodeUnitTraits;
+
+
+template <>
+class CodeUnitTraits<UC8> : private Static {
+ public:
+  RASP_INLINE static UChar Decode(const UC8* it, const UC8* end) {
+    return UChar(unicode::u32(*it));
+  }
+
+
+  RASP_INLINE static size_t Length(const UC8* it, const UC8* end) {
+    return 1;
+  }
+};
+
+
+/**
+ * The surrogate pair is decoded as the one character,
+ * and the lone surrogate is passed to the scanner as is.
+ */
+template <>
+class CodeUnitTraits<UC16> : private Static {
+ public:
+  RASP_INLINE static UChar Decode(const UC16* it, const UC16* end) {
+    if (IsSurrogatePair(it, end)) {
+      return UChar(utf16::FromSurrogatePairUC16(it[0], it[1]));
+    }
+    return UChar(unicode::u32(*it));
+  }
+
+
+  RASP_INLINE static size_t Length(const UC16* it, const UC16* end) {
+    return IsSurrogatePair(it, end)? 2: 1;
+  }
+
+ private:
+  RASP_INLINE static bool IsSurrogatePair(const UC16* it, const UC16* end) {
+    return utf16::IsHighSurrogateUC16(it[0]) && it + 1 != end && utf16::IsLowSurrogateUC16(it[1]);
+  }
+};
+
+
+/**
+ * The iterator which reads the characters from the latin-1 or utf-16 buffer
+ * without converting the buffer to utf-8.
+ * Scanner<CodeUnitIteratorAdapter<UC16>> scans the utf-16 source directly.
+ * The iterator advances by the character, so it is the forward iterator,
+ * and the SourceDistance counts the code units between the iterators,
+ * so the token offsets are the offsets in the buffer like the raw utf-8 pointer.
+ */
+template <typename CodeUnit>
+class CodeUnitIteratorAdapter : public std::iterator<std::forward_iterator_tag, UChar, ptrdiff_t, void, UChar> {
+ public:
+  CodeUnitIteratorAdapter()
+      : it_(nullptr),
+        end_(nullptr) {}
+
+  
+  /**
+   * @param it The current position.
+   * @param end The end of the buffer, which bounds the surrogate pair lookup.
+   */
+  CodeUnitIteratorAdapter(const CodeUnit* it, const CodeUnit* end)
+      : it_(it),
+        end_(end) {}
+
+
+  RASP_INLINE bool operator == (const CodeUnitIteratorAdapter& it) const {return it_ == it.it_;}
+
+
+  RASP_INLINE bool operator != (const CodeUnitIteratorAdapter& it) const {return it_ != it.it_;}
+
+
+  RASP_INLINE UChar operator* () const {
+    return CodeUnitTraits<CodeUnit>::Decode(it_, end_);
+  }
+
+
+  RASP_INLINE CodeUnitIteratorAdapter& operator ++() {
+    it_ += CodeUnitTraits<CodeUnit>::Length(it_, end_);
+    return *this;
+  }
+
+
+  RASP_INLINE CodeUnitIteratorAdapter operator ++(int) {
+    CodeUnitIteratorAdapter it = *this;
+    ++(*this);
+    return it;
+  }
+
+
+  /**
+   * Unwrap iterator.
+   * @return The current position.
+   */
+  RASP_INLINE const CodeUnit* base() const {return it_;}
+
+ private:
+  const CodeUnit* it_;
+  const CodeUnit* end_;
+};
+
+
+/**
+ * The count of the code units between the iterators, which is found by the scanner with the ADL.
+ */
+template <typename CodeUnit>
+RASP_INLINE ptrdiff_t SourceDistance(CodeUnitIteratorAdapter<CodeUnit> begin, CodeUnitIteratorAdapter<CodeUnit> end) {
+  return end.base() - begin.base();
+}
+
+} //namespace rasp
+
+#endif
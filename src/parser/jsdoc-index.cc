@@ -0,0 +1,82 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <string>
+#include "jsdoc-index.h"
+
+namespace rasp {
+
+const size_t JSDocIndex::kNotFound;
+
+
+JSDocIndex::JSDocIndex(const char* source, const TokenStream& token_stream)
+    : source_(source),
+      token_stream_(token_stream) {
+  for (size_t i = 0; i < token_stream.comment_count(); i++) {
+    uint32_t token = token_stream.comment_token(i);
+    // Only the last comment is the JSDoc of the token.
+    if (i + 1 < token_stream.comment_count() && token_stream.comment_token(i + 1) == token) {
+      continue;
+    }
+    if (token >= token_stream.size() || !IsJSDoc(i)) {
+      continue;
+    }
+    switch (token_stream.type(token)) {
+      case Token::JS_FUNCTION:
+      case Token::JS_VAR:
+      case Token::JS_LET:
+      case Token::JS_CONST:
+        entries_.push_back(std::make_pair(token, static_cast<uint32_t>(i)));
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+
+size_t JSDocIndex::Find(size_t token) const {
+  auto found = std::lower_bound(entries_.begin(), entries_.end(), std::make_pair(static_cast<uint32_t>(token), 0u));
+  if (found == entries_.end() || found->first != token) {
+    return kNotFound;
+  }
+  return found->second;
+}
+
+
+UtfString JSDocIndex::CommentValue(size_t comment) const {
+  const char* begin = source_ + token_stream_.comment_offset(comment);
+  UtfString str;
+  str.Append(begin, begin + token_stream_.comment_length(comment));
+  return str;
+}
+
+
+bool JSDocIndex::IsJSDoc(size_t comment) const {
+  // The '/**/' is the empty comment.
+  const char* value = source_ + token_stream_.comment_offset(comment);
+  return token_stream_.comment_length(comment) >= 5 && value[2] == '*';
+}
+}
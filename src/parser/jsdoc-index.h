@@ -0,0 +1,102 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_JSDOC_INDEX_H_
+#define PARSER_JSDOC_INDEX_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "token-stream.h"
+#include "utfstring.h"
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * The index from the declaration tokens to the JSDoc comments which precede them.
+ * The declaration token is the function, the var, the let or the const,
+ * and the JSDoc comment is the multi line comment which starts with slash-star-star.
+ * The index is built from the comment ranges of the TokenStream,
+ * and the text of the comment is decoded only when it is requested.
+ */
+class JSDocIndex : private Uncopyable {
+ public:
+  static const size_t kNotFound = static_cast<size_t>(-1);
+
+  /**
+   * @param source The utf-8 source which the token_stream is scanned from.
+   * @param token_stream The scanned tokens, which must outlive this index.
+   */
+  JSDocIndex(const char* source, const TokenStream& token_stream);
+
+
+  /**
+   * Find the JSDoc comment of the declaration token.
+   * @param token The index of the token in the token stream.
+   * @return The index of the comment in the token stream, or kNotFound.
+   */
+  size_t Find(size_t token) const;
+
+
+  /**
+   * Decode the text of the comment which includes the delimiters.
+   * @param comment The index of the comment in the token stream.
+   */
+  UtfString CommentValue(size_t comment) const;
+
+
+  /**
+   * The count of the declaration tokens which have the JSDoc comment.
+   */
+  RASP_INLINE size_t size() const {
+    return entries_.size();
+  }
+
+
+  /**
+   * The index of the i-th declaration token which has the JSDoc comment.
+   */
+  RASP_INLINE size_t token(size_t i) const {
+    return entries_[i].first;
+  }
+
+
+  /**
+   * The index of the JSDoc comment of the i-th declaration token.
+   */
+  RASP_INLINE size_t comment(size_t i) const {
+    return entries_[i].second;
+  }
+
+ private:
+  bool IsJSDoc(size_t comment) const;
+  
+  const char* source_;
+  const TokenStream& token_stream_;
+  std::vector<std::pair<uint32_t, uint32_t>> entries_;
+};
+}
+
+#endif
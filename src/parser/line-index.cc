@@ -0,0 +1,102 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include "line-index.h"
+#include "byte-search.h"
+
+namespace rasp {
+
+size_t LineIndex::LineNumber(size_t offset) const {
+  EnsureBuilt();
+  return std::upper_bound(line_starts_.begin(), line_starts_.end(), offset) - line_starts_.begin();
+}
+
+
+size_t LineIndex::Column(size_t offset) const {
+  size_t line_start = LineStart(LineNumber(offset));
+  EnsureCheckpointsBuilt();
+  if (ascii_) {
+    return offset - line_start + 1;
+  }
+  return CharacterCount(offset) - CharacterCount(line_start) + 1;
+}
+
+
+size_t LineIndex::LineStart(size_t line_number) const {
+  EnsureBuilt();
+  return line_starts_[line_number - 1];
+}
+
+
+size_t LineIndex::line_count() const {
+  EnsureBuilt();
+  return line_starts_.size();
+}
+
+
+void LineIndex::Build() const {
+  line_starts_.clear();
+  line_starts_.push_back(0);
+  const char* it = begin_;
+  while ((it = ByteSearch::FindLineTerminator(it, end_)) != end_) {
+    if (*it == '\0') {
+      ++it;
+      continue;
+    }
+    it += (*it == '\r' && it + 1 != end_ && *(it + 1) == '\n')? 2: 1;
+    line_starts_.push_back(it - begin_);
+  }
+  built_ = true;
+}
+
+
+void LineIndex::BuildCheckpoints() const {
+  // The checkpoint i is the character count of the first i * kCheckpointInterval bytes.
+  character_checkpoints_.clear();
+  character_checkpoints_.push_back(0);
+  size_t size = end_ - begin_;
+  size_t count = 0;
+  for (size_t position = 0; position + kCheckpointInterval <= size; position += kCheckpointInterval) {
+    count += ByteSearch::CountCharacters(begin_ + position, begin_ + position + kCheckpointInterval);
+    character_checkpoints_.push_back(count);
+  }
+  size_t tail = character_checkpoints_.size() - 1;
+  count += ByteSearch::CountCharacters(begin_ + (tail << kCheckpointBits), end_);
+  
+  // The byte offset is the column offset if the buffer has no multi byte character.
+  ascii_ = count == size;
+  if (ascii_) {
+    character_checkpoints_.clear();
+  }
+  checkpoints_built_ = true;
+}
+
+
+size_t LineIndex::CharacterCount(size_t offset) const {
+  size_t checkpoint = offset >> kCheckpointBits;
+  return character_checkpoints_[checkpoint] +
+      ByteSearch::CountCharacters(begin_ + (checkpoint << kCheckpointBits), begin_ + offset);
+}
+}
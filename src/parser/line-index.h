@@ -0,0 +1,134 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_LINE_INDEX_H_
+#define PARSER_LINE_INDEX_H_
+
+#include <vector>
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * The table of the line start offsets of the utf-8 buffer.
+ * The table is built by the vectorized line terminator search on the first lookup,
+ * so the scanner records only the byte offsets,
+ * and the line numbers are never computed if nobody asks them.
+ * The '\n', the '\r' and the "\r\n" are the line terminators.
+ * The columns are counted from the character count checkpoints
+ * which are recorded every kCheckpointInterval bytes on the first column lookup,
+ * so a lookup never counts more than one interval even if the whole file is one line.
+ */
+class LineIndex {
+ public:
+  LineIndex()
+      : begin_(nullptr),
+        end_(nullptr),
+        built_(false),
+        checkpoints_built_(false),
+        ascii_(false) {}
+
+
+  LineIndex(const char* begin, const char* end)
+      : begin_(begin),
+        end_(end),
+        built_(false),
+        checkpoints_built_(false),
+        ascii_(false) {}
+
+
+  /**
+   * Change the buffer, the table is built again on the next lookup.
+   */
+  void Reset(const char* begin, const char* end) {
+    begin_ = begin;
+    end_ = end;
+    built_ = false;
+    checkpoints_built_ = false;
+    line_starts_.clear();
+    character_checkpoints_.clear();
+  }
+
+
+  /**
+   * The 1-based line number of the byte offset.
+   */
+  size_t LineNumber(size_t offset) const;
+
+
+  /**
+   * The 1-based column of the byte offset, which is counted by the utf-8 characters.
+   */
+  size_t Column(size_t offset) const;
+
+
+  /**
+   * The byte offset of the front of the line.
+   * @param line_number The 1-based line number.
+   */
+  size_t LineStart(size_t line_number) const;
+
+
+  size_t line_count() const;
+
+ private:
+  static const size_t kCheckpointBits = 8;
+  static const size_t kCheckpointInterval = 1 << kCheckpointBits;
+  
+  RASP_INLINE void EnsureBuilt() const {
+    if (!built_) {
+      Build();
+    }
+  }
+
+
+  RASP_INLINE void EnsureCheckpointsBuilt() const {
+    if (!checkpoints_built_) {
+      BuildCheckpoints();
+    }
+  }
+  
+
+  void Build() const;
+
+
+  void BuildCheckpoints() const;
+
+
+  /**
+   * The utf-8 character count of [begin_, begin_ + offset).
+   */
+  size_t CharacterCount(size_t offset) const;
+  
+  const char* begin_;
+  const char* end_;
+  mutable bool built_;
+  mutable bool checkpoints_built_;
+  mutable bool ascii_;
+  mutable std::vector<size_t> line_starts_;
+  mutable std::vector<size_t> character_checkpoints_;
+};
+}
+
+#endif
@@ -0,0 +1,308 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "numeric-conversion.h"
+
+namespace rasp {
+
+namespace {
+// The max count of the decimal digits which are stored in the uint64_t without overflow.
+static const int kMaxMantissaDigits = 19;
+static const uint64_t kMaxExactInteger = uint64_t(1) << 53;
+static const int kMaxExactPowerOfTen = 22;
+static const double kExactPowersOfTen[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+RASP_INLINE bool IsDigit(char c) {
+  return static_cast<unsigned>(c - '0') < 10u;
+}
+
+
+/**
+ * The value of the hex digit, the result is larger than 15 if the c is not the hex digit.
+ * '0'-'9' are 0x30-0x39, 'A'-'F' are 0x41-0x46 and 'a'-'f' are 0x61-0x66,
+ * so the low 4 bits plus 9 for the alphabet is the value.
+ */
+RASP_INLINE uint32_t HexDigitValue(char c) {
+  uint32_t code = static_cast<uint8_t>(c);
+  return (code & 0xF) + 9 * (code >> 6);
+}
+
+
+RASP_INLINE int CountLeadingZeros(uint64_t value) {
+#if defined(__GNUC__)
+  return __builtin_clzll(value);
+#else
+  int count = 0;
+  while ((value & (uint64_t(1) << 63)) == 0) {
+    value <<= 1;
+    count++;
+  }
+  return count;
+#endif
+}
+
+
+RASP_INLINE void Multiply128(uint64_t a, uint64_t b, uint64_t* high, uint64_t* low) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 result = static_cast<unsigned __int128>(a) * b;
+  *high = static_cast<uint64_t>(result >> 64);
+  *low = static_cast<uint64_t>(result);
+#else
+  uint64_t a_low = a & 0xFFFFFFFF;
+  uint64_t a_high = a >> 32;
+  uint64_t b_low = b & 0xFFFFFFFF;
+  uint64_t b_high = b >> 32;
+  uint64_t low_low = a_low * b_low;
+  uint64_t high_low = a_high * b_low;
+  uint64_t low_high = a_low * b_high;
+  uint64_t high_high = a_high * b_high;
+  uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+  *high = high_high + (high_low >> 32) + (middle >> 32);
+  *low = (middle << 32) | (low_low & 0xFFFFFFFF);
+#endif
+}
+
+
+double BitsToDouble(uint64_t bits) {
+  double result;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+
+double Strtod(const char* begin, const char* end) {
+  std::string text(begin, end);
+  return strtod(text.c_str(), nullptr);
+}
+}
+
+
+double NumericConversion::ParseDecimal(const char* begin, const char* end) {
+  // The fast path for the small integer.
+  if (end - begin <= 9) {
+    uint32_t value = 0;
+    const char* it = begin;
+    while (it != end && IsDigit(*it)) {
+      value = value * 10 + (*it - '0');
+      ++it;
+    }
+    if (it == end) {
+      return value;
+    }
+  }
+  
+  const char* it = begin;
+  uint64_t mantissa = 0;
+  int64_t exponent = 0;
+  int digits = 0;
+  bool truncated = false;
+  
+  for (; it != end && IsDigit(*it); ++it) {
+    if (digits < kMaxMantissaDigits) {
+      mantissa = mantissa * 10 + (*it - '0');
+      digits += mantissa != 0? 1: 0;
+    } else {
+      truncated |= *it != '0';
+      exponent++;
+    }
+  }
+
+  if (it != end && *it == '.') {
+    for (++it; it != end && IsDigit(*it); ++it) {
+      if (digits < kMaxMantissaDigits) {
+        mantissa = mantissa * 10 + (*it - '0');
+        digits += mantissa != 0? 1: 0;
+        exponent--;
+      } else {
+        truncated |= *it != '0';
+      }
+    }
+  }
+
+  if (it != end && (*it == 'e' || *it == 'E')) {
+    ++it;
+    bool negative = false;
+    if (it != end && (*it == '+' || *it == '-')) {
+      negative = *it == '-';
+      ++it;
+    }
+    int64_t exponent_value = 0;
+    for (; it != end && IsDigit(*it); ++it) {
+      // The too large exponent is clamped, the value is already 0 or infinity.
+      if (exponent_value < 100000) {
+        exponent_value = exponent_value * 10 + (*it - '0');
+      }
+    }
+    exponent += negative? -exponent_value: exponent_value;
+  }
+
+  if (mantissa == 0) {
+    return 0;
+  }
+
+  double result;
+  if (!truncated) {
+    // Clinger's fast path, the both of the mantissa and the power of ten are exact.
+    if (mantissa <= kMaxExactInteger &&
+        exponent >= -kMaxExactPowerOfTen && exponent <= kMaxExactPowerOfTen) {
+      double value = static_cast<double>(mantissa);
+      return exponent < 0? value / kExactPowersOfTen[-exponent]: value * kExactPowersOfTen[exponent];
+    }
+    if (exponent >= kMinPowerOfTenExponent && exponent <= kMaxPowerOfTenExponent &&
+        EiselLemire(mantissa, static_cast<int>(exponent), &result)) {
+      return result;
+    }
+  } else if (exponent >= kMinPowerOfTenExponent && exponent <= kMaxPowerOfTenExponent) {
+    // The value is between mantissa and mantissa + 1,
+    // so the result is decided if the both are rounded to the same double.
+    double upper;
+    if (EiselLemire(mantissa, static_cast<int>(exponent), &result) &&
+        EiselLemire(mantissa + 1, static_cast<int>(exponent), &upper) &&
+        result == upper) {
+      return result;
+    }
+  }
+  return Strtod(begin, end);
+}
+
+
+bool NumericConversion::ParseRadix(const char* begin, const char* end, int shift, double* result) {
+  const uint32_t radix = 1u << shift;
+  uint64_t value = 0;
+  const char* it = begin;
+  for (; it != end; ++it) {
+    uint32_t digit = HexDigitValue(*it);
+    if (digit >= radix) {
+      return false;
+    }
+    if ((value >> (64 - shift)) != 0) {
+      break;
+    }
+    value = (value << shift) | digit;
+  }
+
+  if (it == end) {
+    *result = static_cast<double>(value);
+    return true;
+  }
+
+  // The value overflows the uint64_t, so the rest digits are kept
+  // only as the binary exponent and the sticky bit which tells whether any of them is not zero.
+  int exponent = 0;
+  bool sticky = false;
+  for (; it != end; ++it) {
+    uint32_t digit = HexDigitValue(*it);
+    if (digit >= radix) {
+      return false;
+    }
+    exponent += shift;
+    sticky |= digit != 0;
+  }
+
+  // Round the value to the 53 bits significand once, to the nearest and the even on the tie.
+  int dropped = 64 - CountLeadingZeros(value) - 53;
+  uint64_t significand = value >> dropped;
+  uint64_t remainder = value & ((uint64_t(1) << dropped) - 1);
+  uint64_t half = uint64_t(1) << (dropped - 1);
+  if (remainder > half || (remainder == half && (sticky || (significand & 1) != 0))) {
+    significand++;
+  }
+  *result = std::ldexp(static_cast<double>(significand), dropped + exponent);
+  return true;
+}
+
+
+// Eisel and Lemire, "Number Parsing at a Gigabyte per Second".
+bool NumericConversion::EiselLemire(uint64_t mantissa, int exponent, double* result) {
+  static const uint64_t kExponentBias = 1023;
+  if (mantissa == 0) {
+    *result = 0;
+    return true;
+  }
+  if (exponent < kMinPowerOfTenExponent || exponent > kMaxPowerOfTenExponent) {
+    return false;
+  }
+
+  // Normalize the mantissa, and approximate the binary exponent by the log2(10) ~ 217706 / 2^16.
+  int leading_zeros = CountLeadingZeros(mantissa);
+  mantissa <<= leading_zeros;
+  uint64_t binary_exponent = static_cast<uint64_t>(((217706 * exponent) >> 16) + 64 + kExponentBias) - leading_zeros;
+
+  const uint64_t* power = kPowerOfTenTable[exponent - kMinPowerOfTenExponent];
+  uint64_t high;
+  uint64_t low;
+  Multiply128(mantissa, power[1], &high, &low);
+
+  // If the low bits of the product may be affected by the truncated part of the power of ten,
+  // use the wider approximation.
+  if ((high & 0x1FF) == 0x1FF && low + mantissa < mantissa) {
+    uint64_t wide_high;
+    uint64_t wide_low;
+    Multiply128(mantissa, power[0], &wide_high, &wide_low);
+    uint64_t merged_high = high;
+    uint64_t merged_low = low + wide_high;
+    if (merged_low < low) {
+      merged_high++;
+    }
+    if ((merged_high & 0x1FF) == 0x1FF && merged_low + 1 == 0 && wide_low + mantissa < mantissa) {
+      return false;
+    }
+    high = merged_high;
+    low = merged_low;
+  }
+
+  // Shift to the 54 bits.
+  uint64_t msb = high >> 63;
+  uint64_t result_mantissa = high >> (msb + 9);
+  binary_exponent -= 1 ^ msb;
+
+  // The halfway case can not be decided.
+  if (low == 0 && (high & 0x1FF) == 0 && (result_mantissa & 3) == 1) {
+    return false;
+  }
+
+  // Round to the 53 bits.
+  result_mantissa += result_mantissa & 1;
+  result_mantissa >>= 1;
+  if ((result_mantissa >> 53) > 0) {
+    result_mantissa >>= 1;
+    binary_exponent++;
+  }
+
+  // The subnormal, the infinity and the NaN are left to the strtod.
+  if (binary_exponent - 1 >= 0x7FF - 1) {
+    return false;
+  }
+  *result = BitsToDouble((binary_exponent << 52) | (result_mantissa & 0x000FFFFFFFFFFFFFULL));
+  return true;
+}
+}
@@ -0,0 +1,70 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_NUMERIC_CONVERSION_H_
+#define PARSER_NUMERIC_CONVERSION_H_
+
+#include <cstdint>
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * Convert the text of the numeric literal to the double.
+ * The text must be already validated by the scanner.
+ */
+class NumericConversion : private Static {
+ public:
+  /**
+   * Convert the decimal literal such as "10", "1.5", ".5" or "1e-10".
+   * The value is exactly computed for the small integers,
+   * and the other values are correctly rounded by the Eisel-Lemire algorithm.
+   * If the algorithm can not decide the rounding, strtod is used.
+   */
+  static double ParseDecimal(const char* begin, const char* end);
+
+
+  /**
+   * Convert the digits of the radix which is the power of 2.
+   * @param shift The bit width of the one digit, 1 for the binary, 3 for the octal and 4 for the hex.
+   * @param result The converted value.
+   * @return false if the digit which is out of the radix is found.
+   */
+  static bool ParseRadix(const char* begin, const char* end, int shift, double* result);
+
+
+  /**
+   * Convert the mantissa * 10^exponent to the double by the Eisel-Lemire algorithm.
+   * @return false if the value can not be decided by the algorithm.
+   */
+  static bool EiselLemire(uint64_t mantissa, int exponent, double* result);
+
+ private:
+  static const int kMinPowerOfTenExponent = -348;
+  static const int kMaxPowerOfTenExponent = 347;
+  static const uint64_t kPowerOfTenTable[][2];
+};
+}
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// This file is generated by tools/gen-operator-table.py, do not edit.
+
+#include "operator-table.h"
+
+namespace rasp {
+
+static_assert(OperatorTable::kClassCount == 23, "Regenerate operator-table.cc.");
+static_assert(OperatorTable::kStateCount == 54, "Regenerate operator-table.cc.");
+static_assert(OperatorTable::kStartState == 47, "Regenerate operator-table.cc.");
+static_assert(OperatorTable::kHarmonyStartState == 53, "Regenerate operator-table.cc.");
+
+const uint8_t OperatorTable::kStartState;
+const uint8_t OperatorTable::kHarmonyStartState;
+const uint8_t OperatorTable::kClassCount;
+const uint8_t OperatorTable::kStateCount;
+
+
+const uint8_t OperatorTable::kCharClass[] = {
+  0, // 0
+  0, // 1
+  0, // 2
+  0, // 3
+  0, // 4
+  0, // 5
+  0, // 6
+  0, // 7
+  0, // 8
+  0, // 9
+  0, // 10
+  0, // 11
+  0, // 12
+  0, // 13
+  0, // 14
+  0, // 15
+  0, // 16
+  0, // 17
+  0, // 18
+  0, // 19
+  0, // 20
+  0, // 21
+  0, // 22
+  0, // 23
+  0, // 24
+  0, // 25
+  0, // 26
+  0, // 27
+  0, // 28
+  0, // 29
+  0, // 30
+  0, // 31
+  0, // 32
+  1, // 33 !
+  0, // 34
+  0, // 35
+  0, // 36
+  2, // 37 %
+  3, // 38 &
+  0, // 39
+  4, // 40 (
+  5, // 41 )
+  6, // 42 *
+  7, // 43 +
+  0, // 44
+  8, // 45 -
+  9, // 46 .
+  10, // 47 /
+  0, // 48
+  0, // 49
+  0, // 50
+  0, // 51
+  0, // 52
+  0, // 53
+  0, // 54
+  0, // 55
+  0, // 56
+  0, // 57
+  11, // 58 :
+  0, // 59
+  12, // 60 <
+  13, // 61 =
+  14, // 62 >
+  15, // 63 ?
+  0, // 64
+  0, // 65
+  0, // 66
+  0, // 67
+  0, // 68
+  0, // 69
+  0, // 70
+  0, // 71
+  0, // 72
+  0, // 73
+  0, // 74
+  0, // 75
+  0, // 76
+  0, // 77
+  0, // 78
+  0, // 79
+  0, // 80
+  0, // 81
+  0, // 82
+  0, // 83
+  0, // 84
+  0, // 85
+  0, // 86
+  0, // 87
+  0, // 88
+  0, // 89
+  0, // 90
+  16, // 91 [
+  0, // 92
+  17, // 93 ]
+  18, // 94 ^
+  0, // 95
+  0, // 96
+  0, // 97
+  0, // 98
+  0, // 99
+  0, // 100
+  0, // 101
+  0, // 102
+  0, // 103
+  0, // 104
+  0, // 105
+  0, // 106
+  0, // 107
+  0, // 108
+  0, // 109
+  0, // 110
+  0, // 111
+  0, // 112
+  0, // 113
+  0, // 114
+  0, // 115
+  0, // 116
+  0, // 117
+  0, // 118
+  0, // 119
+  0, // 120
+  0, // 121
+  0, // 122
+  19, // 123 {
+  20, // 124 |
+  21, // 125 }
+  22, // 126 ~
+  0, // 127
+};
+
+
+// Columns: other ! % & ( ) * + - . / : < = > ? [ ] ^ { | } ~
+const uint8_t OperatorTable::kTransitions[][OperatorTable::kClassCount] = {
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 0
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 1
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 2
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 3
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 4
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 5
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 6
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 7
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 8
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 9
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 10
+  {0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 11
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 12
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 13
+  {0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 14
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 15
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 16
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 17
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 18
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 19
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 20
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 21
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 22
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 23
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 24
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 25
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 26
+  {0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 27
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 28
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 29
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 29, 0, 0}, // 30
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 31
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 32
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 33
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 34
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 35
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 36
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 37
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 38
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 39
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 40
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 41
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 42
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 43
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 44
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 44, 0, 0, 0, 0, 0, 0, 0, 0}, // 45
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 45, 0, 0, 0, 0, 0, 0, 0, 0}, // 46
+  {0, 36, 20, 27, 1, 2, 16, 11, 14, 0, 18, 3, 40, 33, 46, 4, 5, 6, 24, 7, 30, 8, 22}, // 47
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 48
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 48, 0, 0, 0, 0, 0, 0, 0, 0}, // 49
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 50
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 51
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // 52
+  {0, 36, 20, 27, 1, 2, 16, 11, 14, 52, 18, 3, 40, 49, 46, 4, 5, 6, 24, 7, 30, 8, 22}, // 53
+};
+
+
+const Token OperatorTable::kAccept[] = {
+  Token::ILLEGAL, // 0
+  Token::JS_LEFT_PAREN, // 1
+  Token::JS_RIGHT_PAREN, // 2
+  Token::JS_COLON, // 3
+  Token::JS_QUESTION_MARK, // 4
+  Token::JS_LEFT_BRACKET, // 5
+  Token::JS_RIGHT_BRACKET, // 6
+  Token::JS_LEFT_BRACE, // 7
+  Token::JS_RIGHT_BRACE, // 8
+  Token::JS_ADD_LET, // 9
+  Token::JS_INCREMENT, // 10
+  Token::JS_PLUS, // 11
+  Token::JS_SUB_LET, // 12
+  Token::JS_DECREMENT, // 13
+  Token::JS_MINUS, // 14
+  Token::JS_MUL_LET, // 15
+  Token::JS_MUL, // 16
+  Token::JS_DIV_LET, // 17
+  Token::JS_DIV, // 18
+  Token::JS_MOD_LET, // 19
+  Token::JS_MOD, // 20
+  Token::JS_NOR_LET, // 21
+  Token::JS_BIT_NOR, // 22
+  Token::JS_XOR_LET, // 23
+  Token::JS_BIT_XOR, // 24
+  Token::JS_AND_LET, // 25
+  Token::JS_LOGICAL_AND, // 26
+  Token::JS_BIT_AND, // 27
+  Token::JS_OR_LET, // 28
+  Token::JS_LOGICAL_OR, // 29
+  Token::JS_BIT_OR, // 30
+  Token::JS_EQ, // 31
+  Token::JS_EQUAL, // 32
+  Token::JS_ASSIGN, // 33
+  Token::JS_NOT_EQ, // 34
+  Token::JS_NOT_EQUAL, // 35
+  Token::JS_NOT, // 36
+  Token::JS_LESS_EQUAL, // 37
+  Token::JS_SHIFT_LEFT_LET, // 38
+  Token::JS_SHIFT_LEFT, // 39
+  Token::JS_LESS, // 40
+  Token::JS_GREATER_EQUAL, // 41
+  Token::JS_SHIFT_RIGHT_LET, // 42
+  Token::JS_U_SHIFT_RIGHT_LET, // 43
+  Token::JS_U_SHIFT_RIGHT, // 44
+  Token::JS_SHIFT_RIGHT, // 45
+  Token::JS_GREATER, // 46
+  Token::ILLEGAL, // 47
+  Token::JS_FUNCTION_GLYPH, // 48
+  Token::JS_ASSIGN, // 49
+  Token::JS_REST_PARAMETER, // 50
+  Token::ILLEGAL, // 51
+  Token::ILLEGAL, // 52
+  Token::ILLEGAL, // 53
+};
+}
@@ -0,0 +1,74 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_OPERATOR_TABLE_H_
+#define PARSER_OPERATOR_TABLE_H_
+
+#include <cstdint>
+#include "token.h"
+#include "uchar.h"
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * The longest match DFA of the punctuators and the operators.
+ * The table is generated by tools/gen-operator-table.py.
+ */
+class OperatorTable : private Static {
+ public:
+  /**
+   * The dead state, the DFA stops when the transition returns this state.
+   */
+  static const uint8_t kDeadState = 0;
+  static const uint8_t kStartState = 47;
+  static const uint8_t kHarmonyStartState = 53;
+  static const uint8_t kClassCount = 23;
+  static const uint8_t kStateCount = 54;
+
+
+  /**
+   * Return the next state of the state by the character.
+   */
+  RASP_INLINE static uint8_t Next(uint8_t state, UChar uchar) {
+    return kTransitions[state][uchar.IsAscii()? kCharClass[uchar.ToUC8Ascii()]: 0];
+  }
+
+
+  /**
+   * Return the token which is accepted by the state,
+   * or Token::ILLEGAL if the state is not the accepting state.
+   */
+  RASP_INLINE static Token Accept(uint8_t state) {
+    return kAccept[state];
+  }
+
+ private:
+  static const uint8_t kCharClass[];
+  static const uint8_t kTransitions[][kClassCount];
+  static const Token kAccept[];
+};
+}
+
+#endif
@@ -0,0 +1,189 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <thread>
+#include "parallel-scanner.h"
+#include "scanner.h"
+#include "../utils/systeminfo.h"
+
+namespace rasp {
+
+const size_t ParallelScanner::kDefaultMinSegmentSize;
+
+
+ParallelScanner::ParallelScanner(const char* begin,
+                                 const char* end,
+                                 const CompilerOption& compiler_option,
+                                 size_t thread_count,
+                                 size_t min_segment_size)
+    : begin_(begin),
+      end_(end),
+      compiler_option_(compiler_option),
+      rescanned_token_count_(0) {
+  if (thread_count == 0) {
+    thread_count = SystemInfo::GetOnlineProcessorCount();
+  }
+  size_t size = end - begin;
+  size_t count = std::max<size_t>(1, std::min(thread_count, size / std::max<size_t>(1, min_segment_size)));
+  boundaries_.push_back(begin);
+  for (size_t i = 1; i < count; i++) {
+    const char* boundary = begin + size / count * i;
+    // The segment must not start from the middle of the utf-8 byte sequence.
+    while (boundary < end && (static_cast<uint8_t>(*boundary) & 0xC0) == 0x80) {
+      ++boundary;
+    }
+    if (boundary > boundaries_.back() && boundary < end) {
+      boundaries_.push_back(boundary);
+    }
+  }
+  boundaries_.push_back(end);
+}
+
+
+void ParallelScanner::ScanAll(TokenStream* token_stream) {
+  if (static_cast<size_t>(end_ - begin_) > TokenStream::kMaxSourceSize) {
+    FATAL("The source exceeds the max size of the TokenStream.");
+  }
+  std::vector<TokenStream> segments(segment_count());
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < segments.size(); i++) {
+    threads.emplace_back([this, i, &segments]() {ScanSegment(i, &segments[i]);});
+  }
+  ScanSegment(0, &segments[0]);
+  for (auto& thread: threads) {
+    thread.join();
+  }
+  
+  token_stream->Reserve(token_stream->size() + TokenStream::EstimateTokenCount(end_ - begin_));
+  Stitch(segments, token_stream);
+}
+
+
+/**
+ * Scan the tokens which start in the segment,
+ * and the first token which starts in the next segment.
+ * The speculative scan stops at the first ILLEGAL token,
+ * because the wrong start state, e.g. the middle of the escape sequence, produces them,
+ * and the tokens after it are scanned again from the correct state by Stitch.
+ */
+void ParallelScanner::ScanSegment(size_t index, TokenStream* token_stream) const {
+  const char* start = boundaries_[index];
+  uint32_t limit = static_cast<uint32_t>(boundaries_[index + 1] - begin_);
+  Scanner<const char*> scanner(begin_, start, end_, compiler_option_);
+  token_stream->Reserve(TokenStream::EstimateTokenCount(boundaries_[index + 1] - start));
+  while (1) {
+    scanner.AppendComments(token_stream);
+    const TokenInfo* token_info = scanner.ScanWithProgress();
+    token_stream->Push(*token_info, scanner.has_line_terminator_before_next());
+    if (token_info->type() == Token::END_OF_INPUT ||
+        token_info->type() == Token::ILLEGAL ||
+        token_info->source_offset() >= limit) {
+      return;
+    }
+  }
+}
+
+
+void ParallelScanner::Stitch(const std::vector<TokenStream>& segments, TokenStream* token_stream) {
+  rescanned_token_count_ = 0;
+  // The first segment always starts from the correct state.
+  uint32_t next = segments[0].offset(0);
+  // The comments which precede the token at the next are appended by the scanner
+  // which reached the token from the correct state.
+  token_stream->AppendComments(segments[0], 0);
+  
+  for (size_t i = 0; i < segments.size(); i++) {
+    const TokenStream& segment = segments[i];
+    bool last = i + 1 == segments.size();
+    uint32_t limit = static_cast<uint32_t>(boundaries_[i + 1] - begin_);
+    bool next_segment = false;
+    // The tokens from the ILLEGAL token which stopped the speculative scan are always scanned again.
+    size_t trusted = segment.size();
+    if (trusted > 0 && segment.type(trusted - 1) == Token::ILLEGAL) {
+      trusted--;
+    }
+    
+    while (!next_segment) {
+      size_t index = FindToken(segment, next);
+      if (index < trusted) {
+        // The speculative tokens are correct after the token which starts at the correct position.
+        size_t tail = index;
+        while (tail < trusted) {
+          if (segment.type(tail) == Token::END_OF_INPUT) {
+            token_stream->Append(segment, index, tail + 1);
+            return;
+          }
+          if (!last && segment.offset(tail) >= limit) {
+            break;
+          }
+          tail++;
+        }
+        // If no token is taken, the comments which precede the tail are already appended.
+        if (tail > index) {
+          token_stream->Append(segment, index, tail);
+          token_stream->AppendComments(segment, tail);
+        }
+        next = segment.offset(tail);
+        next_segment = tail < trusted;
+      } else {
+        // The speculative start state was wrong, so scan again from the correct position
+        // until the scanner is synchronized with the speculative tokens.
+        Scanner<const char*> scanner(begin_, begin_ + next, end_, compiler_option_);
+        while (1) {
+          scanner.AppendComments(token_stream);
+          const TokenInfo* token_info = scanner.ScanWithProgress();
+          uint32_t offset = static_cast<uint32_t>(token_info->source_offset());
+          if (token_info->type() != Token::END_OF_INPUT &&
+              FindToken(segment, offset) < trusted) {
+            next = offset;
+            break;
+          }
+          if (!last && token_info->type() != Token::END_OF_INPUT && offset >= limit) {
+            next = offset;
+            next_segment = true;
+            break;
+          }
+          token_stream->Push(*token_info, scanner.has_line_terminator_before_next());
+          rescanned_token_count_++;
+          if (token_info->type() == Token::END_OF_INPUT) {
+            return;
+          }
+        }
+      }
+    }
+  }
+}
+
+
+size_t ParallelScanner::FindToken(const TokenStream& token_stream, uint32_t offset) {
+  const uint32_t* begin = token_stream.offsets();
+  const uint32_t* end = begin + token_stream.size();
+  const uint32_t* found = std::lower_bound(begin, end, offset);
+  if (found != end && *found == offset) {
+    return found - begin;
+  }
+  return token_stream.size();
+}
+}
@@ -0,0 +1,104 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_PARALLEL_SCANNER_H_
+#define PARSER_PARALLEL_SCANNER_H_
+
+#include <vector>
+#include "token-stream.h"
+#include "../compiler-option.h"
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * Scan the one large utf-8 buffer on the multiple threads.
+ * The buffer is split into the segments, and each segment is scanned speculatively
+ * as if the segment starts outside of the string literal and the comment.
+ * After that, the segments are stitched sequentially from the front.
+ * If the correct next token of the previous segment is also found in the speculative tokens,
+ * the rest of the segment is used as is, otherwise the tokens are scanned again
+ * until the scanner reaches the token which is found in the speculative tokens.
+ * The result is always same as the tokens which are scanned by the one Scanner.
+ */
+class ParallelScanner : private Uncopyable {
+ public:
+  static const size_t kDefaultMinSegmentSize = 1 MB;
+
+  /**
+   * @param begin The front of the utf-8 buffer.
+   * @param end The end of the utf-8 buffer.
+   * @param thread_count The max count of the segments,
+   *                     SystemInfo::GetOnlineProcessorCount() is used if 0.
+   * @param min_segment_size The buffer is not split into the segments which are smaller than this size.
+   */
+  ParallelScanner(const char* begin,
+                  const char* end,
+                  const CompilerOption& compiler_option,
+                  size_t thread_count = 0,
+                  size_t min_segment_size = kDefaultMinSegmentSize);
+
+
+  /**
+   * Scan the all tokens and append them to the token_stream.
+   * The source must not exceed TokenStream::kMaxSourceSize, otherwise this is fatal.
+   */
+  void ScanAll(TokenStream* token_stream);
+
+
+  RASP_INLINE size_t segment_count() const {
+    return boundaries_.size() - 1;
+  }
+
+
+  /**
+   * The count of the tokens which are scanned again in the last ScanAll,
+   * because the speculative start states of the segments were wrong.
+   */
+  RASP_INLINE size_t rescanned_token_count() const {
+    return rescanned_token_count_;
+  }
+
+ private:
+  void ScanSegment(size_t index, TokenStream* token_stream) const;
+  
+
+  void Stitch(const std::vector<TokenStream>& segments, TokenStream* token_stream);
+  
+  
+  /**
+   * Find the token which starts at the offset.
+   * @return The index of the token or TokenStream::size() if not found.
+   */
+  static size_t FindToken(const TokenStream& token_stream, uint32_t offset);
+  
+  const char* begin_;
+  const char* end_;
+  const CompilerOption& compiler_option_;
+  std::vector<const char*> boundaries_;
+  size_t rescanned_token_count_;
+};
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_REGIONAL_UTF_STRING_H_
+#define PARSER_REGIONAL_UTF_STRING_H_
+
+#include <string.h>
+#include <type_traits>
+#include "../utils/regions.h"
+#include "../utils/utils.h"
+#include "utfstring.h"
+
+namespace rasp {
+
+/**
+ * The immutable utf-8 string which needs no destructor.
+ * The string up to kInlineCapacity bytes is stored in the object itself,
+ * and the longer string is copied to the raw memory of the Regions which is given by the caller.
+ * So the all strings are released at once with the Regions without the destructor call,
+ * and the Regions must outlive the strings.
+ */
+class RegionalUtfString {
+ public:
+  static const size_t kInlineCapacity = 22;
+
+
+  RegionalUtfString() {
+    inline_.value[0] = '\0';
+    inline_.length = 0;
+  }
+
+
+  /**
+   * @param value The utf-8 bytes.
+   * @param length The byte length of the value.
+   * @param regions The Regions which the string longer than kInlineCapacity is allocated from.
+   */
+  RegionalUtfString(const char* value, size_t length, Regions* regions) {
+    if (length <= kInlineCapacity) {
+      memcpy(inline_.value, value, length);
+      inline_.value[length] = '\0';
+      inline_.length = static_cast<uint8_t>(length);
+    } else {
+      char* copied = static_cast<char*>(regions->AllocateRaw(length + 1));
+      memcpy(copied, value, length);
+      copied[length] = '\0';
+      heap_.value = copied;
+      heap_.length = length;
+      inline_.length = kHeap;
+    }
+  }
+
+
+  RegionalUtfString(const UtfString& utf_string, Regions* regions)
+      : RegionalUtfString(utf_string.ToUtf8Value().value(), utf_string.utf8_length(), regions) {}
+
+
+  /**
+   * The null terminated utf-8 bytes.
+   */
+  RASP_INLINE const char* value() const {
+    return is_inline()? inline_.value: heap_.value;
+  }
+
+
+  RASP_INLINE size_t utf8_length() const {
+    return is_inline()? inline_.length: heap_.length;
+  }
+
+
+  RASP_INLINE bool is_inline() const {
+    return inline_.length != kHeap;
+  }
+
+
+  RASP_INLINE Utf8Value ToUtf8Value() const {
+    return Utf8Value(value(), utf8_length());
+  }
+
+
+  /**
+   * Copy the string to the UtfString to get the utf-16 value.
+   */
+  UtfString ToUtfString() const {
+    UtfString utf_string;
+    utf_string.Append(value(), value() + utf8_length());
+    return utf_string;
+  }
+
+
+  RASP_INLINE bool operator == (const RegionalUtfString& utf_string) const {
+    return utf8_length() == utf_string.utf8_length() &&
+        memcmp(value(), utf_string.value(), utf8_length()) == 0;
+  }
+
+
+  RASP_INLINE bool operator != (const RegionalUtfString& utf_string) const {
+    return !((*this) == utf_string);
+  }
+  
+ private:
+  static const uint8_t kHeap = 0xFF;
+  
+  // The length of the inline string is placed at the last byte,
+  // which is not overlapped with the heap string.
+  union {
+    struct {
+      char value[kInlineCapacity + 1];
+      uint8_t length;
+    } inline_;
+    struct {
+      const char* value;
+      size_t length;
+    } heap_;
+  };
+};
+
+
+static_assert(std::is_trivially_destructible<RegionalUtfString>::value,
+              "RegionalUtfString must be released with the Regions.");
+static_assert(sizeof(RegionalUtfString) == 24, "RegionalUtfString must be 24 bytes.");
+
+} //namespace rasp
+
+#endif
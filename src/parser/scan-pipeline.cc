@@ -0,0 +1,121 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <thread>
+#include "scan-pipeline.h"
+#include "scanner.h"
+#include "code-unit-iterator-adapter.h"
+#include "../utils/systeminfo.h"
+
+namespace rasp {
+namespace {
+// Scan the utf-16 source directly, the scanner is not reused because the utf-16 source is rare.
+void ScanUtf16(const SourceStream& source_stream, const CompilerOption& compiler_option, TokenStream* token_stream) {
+  typedef CodeUnitIteratorAdapter<UC16> Iterator;
+  const UC16* begin = source_stream.utf16_begin();
+  const UC16* end = source_stream.utf16_end();
+  Scanner<Iterator> scanner(Iterator(begin, end), Iterator(end, end), compiler_option);
+  scanner.ScanAll(token_stream);
+}
+}
+
+ScanPipeline::ScanPipeline(const CompilerOption& compiler_option, size_t thread_count)
+    : compiler_option_(compiler_option),
+      thread_count_(thread_count == 0? SystemInfo::GetOnlineProcessorCount(): thread_count),
+      next_(0),
+      delivered_(0) {
+  window_size_ = thread_count_ * 4;
+}
+
+
+void ScanPipeline::Run(const std::vector<std::string>& paths, const Callback& callback) {
+  results_.clear();
+  results_.resize(paths.size());
+  next_ = 0;
+  delivered_ = 0;
+  
+  std::vector<std::unique_ptr<Regions>> regions;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < thread_count_; i++) {
+    regions.emplace_back(new Regions(64 KB));
+    Regions* thread_regions = regions.back().get();
+    threads.emplace_back([this, &paths, thread_regions]() {Work(paths, thread_regions);});
+  }
+
+  for (size_t i = 0; i < paths.size(); i++) {
+    std::unique_ptr<Result> result;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      produced_.wait(lock, [this, i]() {return results_[i] != nullptr;});
+      result = std::move(results_[i]);
+      delivered_ = i + 1;
+    }
+    consumed_.notify_all();
+    callback(*result);
+  }
+
+  for (auto& thread: threads) {
+    thread.join();
+  }
+}
+
+
+void ScanPipeline::Work(const std::vector<std::string>& paths, Regions* regions) {
+  std::unique_ptr<Scanner<const char*>> scanner;
+  while (1) {
+    size_t index = next_.fetch_add(1);
+    if (index >= paths.size()) {
+      return;
+    }
+
+    {
+      // Wait for the delivery not to hold too many results.
+      std::unique_lock<std::mutex> lock(mutex_);
+      consumed_.wait(lock, [this, index]() {return index < delivered_ + window_size_;});
+    }
+
+    std::unique_ptr<Result> result(new Result(paths[index], regions));
+    if (result->success()) {
+      const SourceStream& source_stream = result->source_stream_;
+      if (source_stream.utf16()) {
+        ScanUtf16(source_stream, compiler_option_, &result->token_stream_);
+      } else {
+        if (!scanner) {
+          scanner.reset(new Scanner<const char*>(source_stream.raw_begin(), source_stream.raw_end(), compiler_option_));
+        } else {
+          scanner->Reset(source_stream.raw_begin(), source_stream.raw_end());
+        }
+        scanner->set_utf8_validated(source_stream.utf8_validated());
+        scanner->ScanAll(&result->token_stream_);
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      results_[index] = std::move(result);
+    }
+    produced_.notify_all();
+  }
+}
+}
@@ -0,0 +1,129 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_SCAN_PIPELINE_H_
+#define PARSER_SCAN_PIPELINE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "sourcestream.h"
+#include "token-stream.h"
+#include "../compiler-option.h"
+#include "../utils/regions.h"
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * Load and scan the many source files on the worker threads.
+ * Each worker thread reuses the one Scanner for the all files it scans,
+ * and the token arrays are allocated from the Regions of the worker thread.
+ * The results are delivered to the calling thread in the order of the given paths.
+ */
+class ScanPipeline : private Uncopyable {
+ public:
+  /**
+   * The source and the tokens of the one file.
+   * The offsets of the tokens point to the buffer of the source_stream,
+   * which are the utf-16 code unit offsets if the file is utf-16.
+   */
+  class Result : private Uncopyable {
+   public:
+    Result(const std::string& path, Regions* regions)
+        : path_(path),
+          source_stream_(path.c_str()),
+          token_stream_(source_stream_.size(), regions) {}
+
+
+    RASP_INLINE const std::string& path() const {
+      return path_;
+    }
+
+
+    RASP_INLINE bool success() const {
+      return source_stream_.success();
+    }
+
+
+    RASP_INLINE std::string failed_message() const {
+      return source_stream_.failed_message();
+    }
+
+
+    RASP_INLINE const SourceStream& source_stream() const {
+      return source_stream_;
+    }
+
+
+    RASP_INLINE const TokenStream& token_stream() const {
+      return token_stream_;
+    }
+
+   private:
+    friend class ScanPipeline;
+    std::string path_;
+    SourceStream source_stream_;
+    TokenStream token_stream_;
+  };
+
+  
+  typedef std::function<void(const Result&)> Callback;
+
+  
+  /**
+   * @param thread_count The count of the worker threads,
+   *                     SystemInfo::GetOnlineProcessorCount() is used if 0.
+   */
+  explicit ScanPipeline(const CompilerOption& compiler_option, size_t thread_count = 0);
+
+
+  /**
+   * Scan the all files, and call the callback with the result of each file
+   * in the order of the paths on the calling thread.
+   * The result is released after the callback returns.
+   */
+  void Run(const std::vector<std::string>& paths, const Callback& callback);
+
+ private:
+  void Work(const std::vector<std::string>& paths, Regions* regions);
+  
+  const CompilerOption& compiler_option_;
+  size_t thread_count_;
+  // The count of the results which are waiting for the delivery per a thread.
+  size_t window_size_;
+  std::atomic<size_t> next_;
+  size_t delivered_;
+  std::vector<std::unique_ptr<Result>> results_;
+  std::mutex mutex_;
+  std::condition_variable produced_;
+  std::condition_variable consumed_;
+};
+}
+
+#endif
@@ -25,24 +25,68 @@
 #ifndef PARSER_SCANNER_INL_H_
 #define PARSER_SCANNER_INL_H_
 
+#include <algorithm>
 #include <cstdio>
+#include <iterator>
+#include <limits>
 #include <sstream>
 #include "scanner.h"
+#include "byte-search.h"
+#include "operator-table.h"
 #include "token.h"
+#include "unicode-iterator-adapter.h"
 #include "../utils/utils.h"
 
 
 namespace rasp {
+
+/**
+ * The distance between the iterators which is used as the token offset and length.
+ * The iterator which counts the other unit overloads this in its namespace.
+ */
+template <typename InputSourceIterator>
+RASP_INLINE ptrdiff_t SourceDistance(InputSourceIterator begin, InputSourceIterator end) {
+  return std::distance(begin, end);
+}
+
+
 template<typename InputSourceIterator>
-Scanner<InputSourceIterator>::Scanner(InputSourceIterator it,
+Scanner<InputSourceIterator>::Scanner(InputSourceIterator begin,
+                                      InputSourceIterator it,
                                       InputSourceIterator end,
                                       const CompilerOption& compiler_option)
     : has_line_terminator_before_next_(false),
+      end_of_input_scanned_(false),
+      utf8_validated_(false),
       current_position_(0),
       line_number_(1),
+      begin_(begin),
+      cursor_(it),
       it_(it),
       end_(end),
       compiler_option_(compiler_option) {
+  SelectScanFunction();
+  InitializeLineIndex();
+  Advance();
+  SkipWhiteSpace();
+}
+
+
+template<typename InputSourceIterator>
+void Scanner<InputSourceIterator>::Reset(InputSourceIterator begin, InputSourceIterator end) {
+  has_line_terminator_before_next_ = false;
+  end_of_input_scanned_ = false;
+  utf8_validated_ = false;
+  current_position_ = 0;
+  line_number_ = 1;
+  begin_ = begin;
+  cursor_ = begin;
+  it_ = begin;
+  end_ = end;
+  comments_.clear();
+  message_.clear();
+  SelectScanFunction();
+  InitializeLineIndex();
   Advance();
   SkipWhiteSpace();
 }
@@ -51,10 +95,12 @@ Scanner<InputSourceIterator>::Scanner(InputSourceIterator it,
 template<typename InputSourceIterator>
 void Scanner<InputSourceIterator>::Advance()  {
   if (it_ == end_) {
+    cursor_ = end_;
     char_ = UChar::Null();
     return;
   }
 
+  cursor_ = it_;
   char_ = *it_;
   current_position_++;
   ++it_;
@@ -68,46 +114,309 @@ void Scanner<InputSourceIterator>::Advance()  {
 
 
 template<typename InputSourceIterator>
-const TokenInfo* Scanner<InputSourceIterator>::Scan() {
-  has_line_terminator_before_next_ = false;
-  last_multi_line_comment_.Clear();
+size_t Scanner<InputSourceIterator>::ReadRawChar(const char* it, const char* end, bool validated, UChar* uchar) {
+  UC8 byte = static_cast<UC8>(*it);
+  if (byte < 0x80) {
+    *uchar = UChar(unicode::u32(byte));
+    return 1;
+  }
+
+  // Decode the utf-8 byte sequence only if the byte is out of ascii range.
+  size_t byte_count = utf8::GetByteCount(byte);
+  if (validated) {
+    *uchar = UChar(utf8::DecodeUnchecked(it, byte_count));
+    return byte_count;
+  }
+  if (byte_count == 0 || static_cast<size_t>(end - it) < byte_count) {
+    *uchar = UChar::Invalid();
+    return 1;
+  }
+  UnicodeIteratorAdapter<const char*> adapter(it);
+  *uchar = *adapter;
+  if (uchar->IsInvalid()) {
+    *uchar = UChar::Invalid();
+    return 1;
+  }
+  return byte_count;
+}
+
+
+/**
+ * Advance for the raw utf-8 buffer.
+ * Read the ascii byte directly without UnicodeIteratorAdapter.
+ */
+template<>
+inline void Scanner<const char*>::Advance()  {
+  if (it_ == end_) {
+    cursor_ = end_;
+    char_ = UChar::Null();
+    return;
+  }
+
+  cursor_ = it_;
+  it_ += ReadRawChar(it_, end_, utf8_validated_, &char_);
   
-  if (!char_.IsAscii()) {
-    Illegal();
-    return &token_info_;
+  if (it_ == end_) {
+    lookahead1_ = UChar::Null();
+    return;
+  }
+  ReadRawChar(it_, end_, utf8_validated_, &lookahead1_);
+}
+
+
+/**
+ * Seek for the raw utf-8 buffer.
+ * Jump to the target directly, the column is computed by the LineIndex later.
+ */
+template<>
+inline void Scanner<const char*>::Seek(const char* target) {
+  it_ = target;
+  Advance();
+}
+
+
+/**
+ * The raw utf-8 buffer does not count the lines while scanning,
+ * the line numbers are computed from the offsets by the LineIndex.
+ */
+template<>
+inline void Scanner<const char*>::LineFeed() {}
+
+
+template<>
+inline void Scanner<const char*>::UpdateTokenInfo() {}
+
+
+template<>
+inline void Scanner<const char*>::InitializeLineIndex() {
+  line_index_.Reset(begin_, end_);
+  token_info_.set_line_index(&line_index_);
+}
+
+
+template<>
+inline size_t Scanner<const char*>::current_position() const {
+  return line_index_.Column(cursor_ - begin_);
+}
+
+
+template<>
+inline size_t Scanner<const char*>::line_number() const {
+  return line_index_.LineNumber(cursor_ - begin_);
+}
+
+
+template<>
+inline void Scanner<const char*>::SkipToLineTerminator() {
+  Seek(ByteSearch::FindLineTerminator(cursor_, end_));
+}
+
+
+template<>
+inline void Scanner<const char*>::SkipBlank() {
+  const char* next = ByteSearch::SkipWhiteSpace(cursor_, end_);
+  // The ';' is not the white space.
+  if (next == cursor_) {
+    return Advance();
   }
+  Seek(next);
+}
+
+
+template<typename InputSourceIterator>
+void Scanner<InputSourceIterator>::ScanMultiLineComment() {
+  InputSourceIterator begin = cursor_;
+  // Consume the '/' and the '*'.
+  Advance();
+  Advance();
+  while (char_ != unicode::u8('\0') && !Character::IsMultiLineCommentEnd(char_, lookahead1_)) {
+    Character::LineBreakType lt = Character::GetLineBreakType(char_, lookahead1_);
+    if (lt == Character::LineBreakType::CRLF) {
+      Advance();
+    }
+    Advance();
+    if (lt != Character::LineBreakType::NONE) {
+      LineFeed();
+      has_line_terminator_before_next_ = true;
+    }
+  }
+
+  // The unterminated comment ends at the end of the input.
+  if (char_ != unicode::u8('\0')) {
+    Advance();
+    Advance();
+  }
+  comments_.push_back(CommentRange{begin, cursor_});
+}
+
+
+/**
+ * ScanMultiLineComment for the raw utf-8 buffer.
+ * Find the end of the comment first, and then count the line terminators in the comment.
+ */
+template<>
+inline void Scanner<const char*>::ScanMultiLineComment() {
+  const char* begin = cursor_;
+  const char* comment_end = ByteSearch::FindMultiLineCommentEnd(begin + 2, end_);
+  const char* last = comment_end;
+  if (comment_end != end_ && *comment_end == '*') {
+    last += 2;
+  }
+
+  // The '\0' in the comment is not the line terminator.
+  const char* lt = begin;
+  while ((lt = ByteSearch::FindLineTerminator(lt, comment_end)) != comment_end) {
+    if (*lt != '\0') {
+      has_line_terminator_before_next_ = true;
+      break;
+    }
+    ++lt;
+  }
+  Seek(last);
+  comments_.push_back(CommentRange{begin, last});
+}
+
+
+template<typename InputSourceIterator>
+UtfString Scanner<InputSourceIterator>::CommentValue(const CommentRange& range) const {
+  UtfString str;
+  for (InputSourceIterator it = range.begin; it != range.end; ++it) {
+    str += *it;
+  }
+  return str;
+}
+
+
+template<>
+inline UtfString Scanner<const char*>::CommentValue(const CommentRange& range) const {
+  UtfString str;
+  if (utf8_validated_) {
+    str.Append(range.begin, range.end);
+    return str;
+  }
+  for (const char* it = range.begin; it != range.end;) {
+    UChar uchar;
+    it += ReadRawChar(it, range.end, utf8_validated_, &uchar);
+    if (!uchar.IsInvalid()) {
+      str += uchar;
+    }
+  }
+  return str;
+}
+
+
+template<typename InputSourceIterator>
+void Scanner<InputSourceIterator>::AppendComments(TokenStream* token_stream) const {
+  for (const CommentRange& range: comments_) {
+    token_stream->PushComment(static_cast<uint32_t>(SourceDistance(begin_, range.begin)),
+                              static_cast<uint32_t>(SourceDistance(range.begin, range.end)));
+  }
+}
+
+
+template<typename InputSourceIterator>
+void Scanner<InputSourceIterator>::SelectScanFunction() {
+  switch (compiler_option_.language_mode()) {
+    case LanguageMode::ES3:
+      scan_function_ = &Scanner::ScanToken<LanguageMode::ES3>;
+      break;
+    case LanguageMode::ES5_STRICT:
+      scan_function_ = &Scanner::ScanToken<LanguageMode::ES5_STRICT>;
+      break;
+    default:
+      scan_function_ = &Scanner::ScanToken<LanguageMode::HARMONY>;
+  }
+}
+
+
+template<typename InputSourceIterator>
+template <LanguageMode kLanguageMode>
+const TokenInfo* Scanner<InputSourceIterator>::ScanToken() {
+  has_line_terminator_before_next_ = false;
+  comments_.clear();
+  token_info_.set_atom(AtomTable::kInvalidAtom);
+  InputSourceIterator token_start = cursor_;
   
-  if (char_ == unicode::u8('\0')) {
+  // Identifier and digit scanners stop at the next character of the token,
+  // other scanners stop at the last character of the token.
+  if (!char_.IsAscii()) {
+    if (Character::IsIdentifierStart(char_)) {
+      ScanIdentifier<kLanguageMode>();
+    } else {
+      Illegal();
+      Advance();
+    }
+  } else if (char_ == unicode::u8('\0')) {
     BuildToken(Token::END_OF_INPUT);
   } else if (char_ == unicode::u8(';')) {
-    return Scan();
-  } else if (Character::IsPuncture(char_)) {
-    BuildToken(TokenInfo::GetPunctureType(char_));
+    return ScanToken<kLanguageMode>();
   } else if (Character::IsIdentifierStart(char_) ||
              Character::IsUnicodeEscapeSequenceStart(char_, lookahead1_)) {
-    ScanIdentifier();
+    ScanIdentifier<kLanguageMode>();
   } else if (Character::IsStringLiteralStart(char_)) {
     ScanStringLiteral();
+    Advance();
   } else if (Character::IsDigitStart(char_, lookahead1_)) {
-    ScanDigit();
+    ScanDigit<kLanguageMode>();
   } else if (Character::IsOperatorStart(char_)) {
-    ScanOperator();
+    ScanOperator<kLanguageMode>();
+    Advance();
   } else {
     Illegal();
+    Advance();
+  }
+
+  token_info_.set_source_range(SourceDistance(begin_, token_start),
+                               SourceDistance(token_start, cursor_));
+  SkipWhiteSpace();
+  return &token_info_;
+}
+
+
+template<typename InputSourceIterator>
+void Scanner<InputSourceIterator>::ScanAll(TokenStream* token_stream) {
+  if (static_cast<size_t>(SourceDistance(begin_, end_)) > TokenStream::kMaxSourceSize) {
+    FATAL("The source exceeds the max size of the TokenStream.");
+  }
+  token_stream->Reserve(token_stream->size() +
+                        TokenStream::EstimateTokenCount(SourceDistance(cursor_, end_)));
+  while (ScanBatch(token_stream, std::numeric_limits<size_t>::max()) > 0) {}
+}
+
+
+template<typename InputSourceIterator>
+size_t Scanner<InputSourceIterator>::ScanBatch(TokenStream* token_stream, size_t max_count) {
+  size_t count = 0;
+  while (count < max_count && !end_of_input_scanned_) {
+    AppendComments(token_stream);
+    const TokenInfo* token_info = ScanWithProgress();
+    token_stream->Push(*token_info, has_line_terminator_before_next_);
+    end_of_input_scanned_ = token_info->type() == Token::END_OF_INPUT;
+    count++;
   }
+  return count;
+}
+
 
-  if (!SkipWhiteSpace()) {
+template<typename InputSourceIterator>
+const TokenInfo* Scanner<InputSourceIterator>::ScanWithProgress() {
+  InputSourceIterator token_start = cursor_;
+  const TokenInfo* token_info = Scan();
+  // The error token which consumed nothing is scanned again forever,
+  // so skip the character to make progress.
+  if (cursor_ == token_start && token_info->type() != Token::END_OF_INPUT) {
     Advance();
+    SkipWhiteSpace();
   }
-  return &token_info_;
+  return token_info;
 }
 
 
 template<typename InputSourceIterator>
-UC16 Scanner<InputSourceIterator>::ScanHexEscape(const UChar& uchar, int len, bool* success) {
+UC16 Scanner<InputSourceIterator>::ScanHexEscape(int len, bool* success) {
   UC16 result = 0;
   for (int i = 0; i < len; ++i) {
-    const int d = ToHexValue(uchar);
+    const int d = ToHexValue(char_);
     if (d < 0) {
       *success = false;
       return d;
@@ -123,42 +432,105 @@ UC16 Scanner<InputSourceIterator>::ScanHexEscape(const UChar& uchar, int len, bo
 template<typename InputSourceIterator>
 void Scanner<InputSourceIterator>::ScanStringLiteral() {
   UChar quote = char_;
-  UtfString v;
-  bool escaped = false;
-  while (1) {
-    Advance();
-    if (char_ == quote) {
-      if (!escaped) {
-        break;
-      }
-      escaped = false;
-    } else if (char_ == unicode::u8('\0')) {
+  // The escaped surrogates are kept as is in the utf-16.
+  UtfString v(UtfString::Encoding::UTF16);
+  Advance();
+  while (char_ != quote) {
+    if (char_ == unicode::u8('\0') ||
+        Character::GetLineBreakType(char_, lookahead1_) != Character::LineBreakType::NONE) {
       return Error("Unterminated string literal.");
-    } else if (char_ == unicode::u8('\\')) {
-      if (!escaped) {
-        if (lookahead1_ == unicode::u8('u')) {
-          if (!ScanUnicodeEscapeSequence(&v)) {
-            return;
-          }
-        } else if (lookahead1_ == unicode::u8('x')) {
-          if (!ScanAsciiEscapeSequence(&v)) {
-            return;
-          }
-        } else {
-          escaped = !escaped; 
+    }
+
+    if (char_ == unicode::u8('\\')) {
+      if (lookahead1_ == unicode::u8('u')) {
+        if (!ScanUnicodeEscapeSequence(&v)) {
+          return;
+        }
+        continue;
+      } else if (lookahead1_ == unicode::u8('x')) {
+        if (!ScanAsciiEscapeSequence(&v)) {
+          return;
         }
-      } else {
-        escaped = !escaped;
+        continue;
+      }
+
+      // The other escape sequences are kept as is.
+      v += char_;
+      Advance();
+      if (ConsumeLineContinuation(&v)) {
+        continue;
+      }
+      if (char_ == unicode::u8('\0')) {
+        return Error("Unterminated string literal.");
       }
     }
     v += char_;
+    Advance();
   }
 
   BuildToken(Token::JS_STRING_LITERAL, std::move(v));
 }
 
 
+/**
+ * ScanStringLiteral for the raw utf-8 buffer.
+ * Skip the characters which need not to be checked by the SIMD search,
+ * and store the string literal body as the range of the source buffer.
+ */
+template<>
+inline void Scanner<const char*>::ScanStringLiteral() {
+  const char quote = *cursor_;
+  const char* begin = cursor_ + 1;
+  bool has_escapes = false;
+  Advance();
+  while (1) {
+    Seek(ByteSearch::FindStringLiteralSpecial(cursor_, end_, quote));
+    if (char_ == unicode::u8(quote)) {
+      break;
+    }
+
+    if (char_ == UChar::Invalid()) {
+      return Error("Invalid utf-8 sequence.");
+    }
+    
+    if (char_ == unicode::u8('\0') ||
+        Character::GetLineBreakType(char_, lookahead1_) != Character::LineBreakType::NONE) {
+      return Error("Unterminated string literal.");
+    }
+
+    if (char_ == unicode::u8('\\')) {
+      has_escapes = true;
+      if (lookahead1_ == unicode::u8('u')) {
+        if (!ScanUnicodeEscapeSequence(nullptr)) {
+          return;
+        }
+        continue;
+      } else if (lookahead1_ == unicode::u8('x')) {
+        if (!ScanAsciiEscapeSequence(nullptr)) {
+          return;
+        }
+        continue;
+      }
+      
+      Advance();
+      if (ConsumeLineContinuation(nullptr)) {
+        continue;
+      }
+      if (char_ == unicode::u8('\0')) {
+        return Error("Unterminated string literal.");
+      }
+    }
+    // The escaped character or the non ascii character.
+    Advance();
+  }
+
+  BuildToken(Token::JS_STRING_LITERAL);
+  token_info_.set_raw_value(begin_, begin - begin_, cursor_ - begin, has_escapes);
+}
+
+
 template<typename InputSourceIterator>
+template <LanguageMode kLanguageMode>
 void Scanner<InputSourceIterator>::ScanDigit() {
   if (char_ == unicode::u8('0') && lookahead1_ == unicode::u8('x')) {
     return ScanHex();
@@ -166,12 +538,17 @@ void Scanner<InputSourceIterator>::ScanDigit() {
 
   if (char_ == unicode::u8('0')) {
     if (Character::IsNumericLiteral(lookahead1_)) {
-      if (!LanguageModeUtil::IsOctalLiteralAllowed(compiler_option_)) {
+      if (!LanguageModeTraits<kLanguageMode>::kOctalLiteralAllowed) {
+        SkipNumericLiteral();
         return Error("Octal literals are not allowed in strict mode.");
       }
       return ScanOctalLiteral();
     } else if (lookahead1_ == unicode::u8('o') || lookahead1_ == unicode::u8('O')) {
-      if (!LanguageModeUtil::IsBinaryLiteralAllowed(compiler_option_)) {
+      if (!LanguageModeTraits<kLanguageMode>::kBinaryLiteralAllowed) {
+        // Skip the "0o" prefix and the digits.
+        Advance();
+        Advance();
+        SkipNumericLiteral();
         return Error("Binary literals are allowed only in harmony mode.");
       }
       return ScanBinaryLiteral();
@@ -189,7 +566,7 @@ void Scanner<InputSourceIterator>::ScanDigit() {
 
 template<typename InputSourceIterator>
 void Scanner<InputSourceIterator>::ScanHex() {
-  UtfString v;
+  ValueBuilder v(cursor_);
   v += char_;
   Advance();
   v += char_;
@@ -198,24 +575,24 @@ void Scanner<InputSourceIterator>::ScanHex() {
     v += char_;
     Advance();
   }
-  BuildToken(Token::JS_NUMERIC_LITERAL, std::move(v));
+  BuildNumericToken(Token::JS_NUMERIC_LITERAL, &v, 2, 4);
 }
 
 
 template<typename InputSourceIterator>
 void Scanner<InputSourceIterator>::ScanOctalLiteral() {
-  UtfString str;
+  ValueBuilder str(cursor_);
   while (Character::IsNumericLiteral(char_)) {
     str += char_;
     Advance();
   }
-  BuildToken(Token::JS_OCTAL_LITERAL, std::move(str));
+  BuildNumericToken(Token::JS_OCTAL_LITERAL, &str, 1, 3);
 }
 
 
 template<typename InputSourceIterator>
 void Scanner<InputSourceIterator>::ScanBinaryLiteral() {
-  UtfString str;
+  ValueBuilder str(cursor_);
   str += char_;
   Advance();
   str += char_;
@@ -227,13 +604,13 @@ void Scanner<InputSourceIterator>::ScanBinaryLiteral() {
     str += char_;
     Advance();
   }
-  BuildToken(Token::JS_BINARY_LITERAL, std::move(str));
+  BuildNumericToken(Token::JS_BINARY_LITERAL, &str, 2, 1);
 }
 
 
 template<typename InputSourceIterator>
 void Scanner<InputSourceIterator>::ScanInteger() {
-  UtfString v;
+  ValueBuilder v(cursor_);
   v += char_;
   bool js_double = char_ == unicode::u8('.');
   bool exponent = false;
@@ -274,16 +651,18 @@ void Scanner<InputSourceIterator>::ScanInteger() {
     return Illegal();
   }
   
-  BuildToken(Token::JS_NUMERIC_LITERAL, std::move(v));
+  BuildNumericToken(Token::JS_NUMERIC_LITERAL, &v, 0, 0);
 }
 
 
 template<typename InputSourceIterator>
+template <LanguageMode kLanguageMode>
 void Scanner<InputSourceIterator>::ScanIdentifier() {
-  UtfString v;  
-  while (Character::IsInIdentifierRange(char_) || char_ == unicode::u8('\\')) {
+  UtfString v;
+  bool start = true;
+  for (; Character::IsInIdentifierRange(char_) || char_ == unicode::u8('\\'); start = false) {
     if (char_ == unicode::u8('\\')) {
-      if (!ScanUnicodeEscapeSequence(&v)) {
+      if (!ScanIdentifierEscapeSequence(&v, start)) {
         return;
       }
     } else {
@@ -292,100 +671,82 @@ void Scanner<InputSourceIterator>::ScanIdentifier() {
     }
   }
   Utf8Value utf8_value = v.ToUtf8Value();
-  Token type = TokenInfo::GetIdentifierType(utf8_value.value(),
-                                            LanguageModeUtil::IsHarmony(compiler_option_));
+  Token type = TokenInfo::GetIdentifierType<LanguageModeTraits<kLanguageMode>::kHarmony>(
+      utf8_value.value(), utf8_value.size());
+  if (type == Token::JS_IDENTIFIER) {
+    token_info_.set_atom(AtomTable::Default()->Intern(utf8_value.value(), utf8_value.size()));
+  }
   BuildToken(type, std::move(v));
 }
 
 
-template<typename InputSourceIterator>
-void Scanner<InputSourceIterator>::ScanOperator() {
-  switch (char_.ToAscii()) {
-    case '+':
-      return ScanArithmeticOperator(Token::JS_INCREMENT, Token::JS_ADD_LET, Token::JS_PLUS);
-    case '-':
-      return ScanArithmeticOperator(Token::JS_DECREMENT, Token::JS_SUB_LET, Token::JS_MINUS);
-    case '*':
-      return ScanArithmeticOperator(Token::ILLEGAL, Token::JS_MUL_LET, Token::JS_MUL, false);
-    case '/':
-      return ScanArithmeticOperator(Token::ILLEGAL, Token::JS_DIV_LET, Token::JS_DIV, false);
-    case '%':
-      return ScanArithmeticOperator(Token::ILLEGAL, Token::JS_MOD_LET, Token::JS_MOD, false);
-    case '~':
-      return ScanArithmeticOperator(Token::ILLEGAL, Token::JS_NOR_LET, Token::JS_BIT_NOR, false);
-    case '^':
-      return ScanArithmeticOperator(Token::ILLEGAL, Token::JS_XOR_LET, Token::JS_BIT_XOR, false);
-    case '&':
-      return ScanLogicalOperator(Token::JS_LOGICAL_AND, Token::JS_AND_LET, Token::JS_BIT_AND);
-    case '|':
-      return ScanLogicalOperator(Token::JS_LOGICAL_OR, Token::JS_OR_LET, Token::JS_BIT_OR);
-    case '=':
-      return ScanEqualityComparator();
-    case '!':
-      if (lookahead1_ == unicode::u8('=')) {
-        Advance();
-        return ScanEqualityComparator(true);
+/**
+ * ScanIdentifier for the raw utf-8 buffer.
+ * The identifier is stored as the range of the source buffer,
+ * and only the identifier which has the escape sequences is decoded.
+ */
+template<>
+template <LanguageMode kLanguageMode>
+inline void Scanner<const char*>::ScanIdentifier() {
+  const char* start = cursor_;
+  bool has_escapes = false;
+  while (Character::IsInIdentifierRange(char_) || char_ == unicode::u8('\\')) {
+    if (char_ == unicode::u8('\\')) {
+      has_escapes = true;
+      if (!ScanIdentifierEscapeSequence(nullptr, cursor_ == start)) {
+        return;
       }
-      return BuildToken(Token::JS_NOT);
-    case '<':
-      return ScanBitwiseOrComparationOperator(
-          Token::JS_SHIFT_LEFT, Token::JS_SHIFT_LEFT_LET, Token::ILLEGAL, Token::JS_LESS, Token::JS_LESS_EQUAL);
-    case '>':
-      return ScanBitwiseOrComparationOperator(
-          Token::JS_SHIFT_RIGHT, Token::JS_SHIFT_RIGHT_LET,
-          Token::JS_U_SHIFT_RIGHT, Token::JS_GREATER, Token::JS_GREATER_EQUAL, true);
-    default:
-      Illegal();
+    } else {
+      Advance();
+    }
   }
-}
-
-
-template<typename InputSourceIterator>
-void Scanner<InputSourceIterator>::ScanArithmeticOperator(Token type1, Token type2, Token normal, bool has_let) {
-  if (has_let && lookahead1_ == char_) {
-    return BuildToken(type1);
+  
+  token_info_.set_raw_value(begin_, start - begin_, cursor_ - start, has_escapes);
+  const char* value = start;
+  size_t length = cursor_ - start;
+  if (has_escapes) {
+    Utf8Value utf8_value = token_info_.value().ToUtf8Value();
+    value = utf8_value.value();
+    length = utf8_value.size();
   }
-  if (lookahead1_ == unicode::u8('=')) {
-    return BuildToken(type2);
+  Token type = TokenInfo::GetIdentifierType<LanguageModeTraits<kLanguageMode>::kHarmony>(value, length);
+  if (type == Token::JS_IDENTIFIER) {
+    token_info_.set_atom(AtomTable::Default()->Intern(value, length));
   }
-  BuildToken(normal);
+  BuildToken(type);
 }
 
 
-template<typename InputSourceIterator>
-void Scanner<InputSourceIterator>::ScanBitwiseOrComparationOperator(
-    Token type1, Token type2, Token type3, Token normal, Token equal_comparator, bool has_u) {
-  if (lookahead1_ == char_) {
-    Advance();
-    if (lookahead1_ == unicode::u8('=')) {
-      Advance();
-      return BuildToken(type2);
-    } else if (has_u && lookahead1_ == char_) {
-      return BuildToken(type3);
-    }
-    return BuildToken(type1);
-  } else if (lookahead1_ == unicode::u8('=')) {
-    return BuildToken(equal_comparator);
-  }
-  BuildToken(normal);
+template<>
+inline void Scanner<const char*>::BuildToken(Token type, ValueBuilder* builder) {
+  BuildToken(type);
+  token_info_.set_raw_value(begin_, builder->start() - begin_, cursor_ - builder->start(), false);
 }
 
 
 template<typename InputSourceIterator>
-void Scanner<InputSourceIterator>::ScanEqualityComparator(bool not) {
-  if (lookahead1_ == char_) {
+template <LanguageMode kLanguageMode>
+void Scanner<InputSourceIterator>::ScanOperator() {
+  uint8_t state = OperatorTable::Next(
+      LanguageModeTraits<kLanguageMode>::kHarmony?
+      OperatorTable::kHarmonyStartState: OperatorTable::kStartState, char_);
+  // Advance while the next character extends the operator,
+  // so that the scanner stops at the last character of the longest match.
+  uint8_t next;
+  while ((next = OperatorTable::Next(state, lookahead1_)) != OperatorTable::kDeadState) {
     Advance();
-    if (!not && lookahead1_ == char_) {
-      return BuildToken(Token::JS_EQ);
-    }
-    return BuildToken(not? Token::JS_NOT_EQ: Token::JS_EQUAL);
+    state = next;
   }
-  BuildToken(not? Token::JS_NOT_EQUAL: Token::JS_ASSIGN);
+  Token type = OperatorTable::Accept(state);
+  if (type == Token::ILLEGAL) {
+    return Illegal();
+  }
+  BuildToken(type);
 }
 
 
 template<typename InputSourceIterator>
-bool Scanner<InputSourceIterator>::ScanUnicodeEscapeSequence(UtfString* v) {
+bool Scanner<InputSourceIterator>::ScanUnicodeEscapeSequence(UtfString* v, UC16* uc16) {
   Advance();
   if (char_ != unicode::u8('u')) {
     Error("Illegal Token");
@@ -393,17 +754,31 @@ bool Scanner<InputSourceIterator>::ScanUnicodeEscapeSequence(UtfString* v) {
   }
   Advance();
   bool success;
-  UC16 uc16 = ScanHexEscape(char_, 4, &success);
-  if (!success || uc16 == '\\' || !Character::IsIdentifierStartChar(uc16)) {
+  UC16 c = ScanHexEscape(4, &success);
+  if (!success) {
     Illegal();
     return false;
   }
-  UC8Bytes bytes = utf16::Convertor::Convert(uc16, 0);
-  if (bytes.size() == 0) {
+  if (v != nullptr) {
+    (*v) += UChar(c);
+  }
+  if (uc16 != nullptr) {
+    *uc16 = c;
+  }
+  return true;
+}
+
+
+template<typename InputSourceIterator>
+bool Scanner<InputSourceIterator>::ScanIdentifierEscapeSequence(UtfString* v, bool start) {
+  UC16 uc16;
+  if (!ScanUnicodeEscapeSequence(v, &uc16)) {
+    return false;
+  }
+  if (start? !Character::IsIdentifierStartChar(uc16): !Character::IsIdentifierPartChar(uc16)) {
     Illegal();
     return false;
   }
-  (*v) += UChar(uc16, bytes);
   return true;
 }
 
@@ -417,13 +792,14 @@ bool Scanner<InputSourceIterator>::ScanAsciiEscapeSequence(UtfString* v) {
   }
   Advance();
   bool success;
-  UC8 uc8 = unicode::u8(ScanHexEscape(char_, 2, &success));
+  UC8 uc8 = unicode::u8(ScanHexEscape(2, &success));
   if (!success || !utf8::IsAscii(uc8)) {
     Illegal();
     return false;
   }
-  UC8Bytes bytes{{static_cast<char>(uc8), '\0'}};
-  (*v) += UChar(uc8, bytes);
+  if (v != nullptr) {
+    (*v) += UChar(unicode::u32(uc8));
+  }
   return true;
 }
 
@@ -447,6 +823,26 @@ bool Scanner<InputSourceIterator>::ConsumeLineBreak() {
   return is_break;
 }
 
+template <typename InputSourceIterator>
+bool Scanner<InputSourceIterator>::ConsumeLineContinuation(UtfString* v) {
+  Character::LineBreakType lt = Character::GetLineBreakType(char_, lookahead1_);
+  if (lt == Character::LineBreakType::NONE) {
+    return false;
+  }
+  if (lt == Character::LineBreakType::CRLF) {
+    if (v != nullptr) {
+      (*v) += char_;
+    }
+    Advance();
+  }
+  if (v != nullptr) {
+    (*v) += char_;
+  }
+  Advance();
+  LineFeed();
+  return true;
+}
+
 } //namespace rasp
 
 #endif
@@ -26,32 +26,215 @@
 #define PARSER_SCANNER_H_
 
 #include <sstream>
+#include <vector>
 #include "character.h"
+#include "line-index.h"
+#include "numeric-conversion.h"
 #include "token.h"
+#include "token-stream.h"
 #include "utfstring.h"
 #include "../compiler-option.h"
 
 
 namespace rasp {
+/**
+ * Collect the characters of the token value.
+ */
+template <typename InputSourceIterator>
+class TokenValueBuilder {
+ public:
+  explicit TokenValueBuilder(InputSourceIterator) {}
+
+
+  RASP_INLINE TokenValueBuilder& operator += (UChar uchar) {
+    value_ += uchar;
+    return *this;
+  }
+
+
+  RASP_INLINE UtfString& value() {
+    return value_;
+  }
+
+ private:
+  UtfString value_;
+};
+
+
+/**
+ * The TokenValueBuilder for the raw utf-8 buffer.
+ * The characters are not collected,
+ * because the token value is the range of the source buffer.
+ */
+template <>
+class TokenValueBuilder<const char*> {
+ public:
+  explicit TokenValueBuilder(const char* start)
+      : start_(start) {}
+
+
+  RASP_INLINE TokenValueBuilder& operator += (UChar) {
+    return *this;
+  }
+
+
+  RASP_INLINE const char* start() const {
+    return start_;
+  }
+
+ private:
+  const char* start_;
+};
+
+
+/**
+ * The javascript token scanner.
+ * The InputSourceIterator must yield rasp::UChar,
+ * or must be a const char* which point to the contiguous utf-8 buffer.
+ * If the const char* is given, the scanner reads the ascii byte directly from the buffer
+ * and decodes the utf-8 byte sequence only if it meets the non ascii byte.
+ */
 template <typename InputSourceIterator>
 class Scanner {
+ private:
+  /**
+   * The range of the multi line comment which includes the opening and the closing delimiters.
+   */
+  struct CommentRange {
+    InputSourceIterator begin;
+    InputSourceIterator end;
+  };
+  
  public:
+  typedef TokenValueBuilder<InputSourceIterator> ValueBuilder;
+  
+
   /**
    * @param source The source file content.
    */
   Scanner(InputSourceIterator it,
+          InputSourceIterator end,
+          const CompilerOption& compilation_option)
+      : Scanner(it, it, end, compilation_option) {}
+
+
+  /**
+   * Start scanning from the middle of the source.
+   * The offsets of the tokens are counted from the begin,
+   * and the line number and the column are counted from the start.
+   * @param begin The front of the source.
+   * @param start The position which the scanner starts from.
+   * @param end The end of the source.
+   */
+  Scanner(InputSourceIterator begin,
+          InputSourceIterator start,
           InputSourceIterator end,
           const CompilerOption& compilation_option);
 
   /**
    * Scan the source file from the current position to the next token position.
+   * The scanner which is specialized for the language mode is selected on the construction.
+   */
+  RASP_INLINE const TokenInfo* Scan() {
+    return (this->*scan_function_)();
+  }
+
+
+  /**
+   * Scan the next token like Scan, and skip a character if the token consumed nothing,
+   * so the loop which scans until the Token::END_OF_INPUT always terminates.
+   */
+  const TokenInfo* ScanWithProgress();
+
+
+  /**
+   * Scan the all remaining tokens and append them to the token_stream.
+   * The capacity of the token_stream is reserved from the remaining source size.
+   * The last token of the token_stream is the Token::END_OF_INPUT.
+   * The source must not exceed TokenStream::kMaxSourceSize, otherwise this is fatal,
+   * because the offsets of the token_stream are uint32_t.
+   */
+  void ScanAll(TokenStream* token_stream);
+
+
+  /**
+   * Scan at most max_count tokens and append them to the token_stream.
+   * @return The count of the appended tokens, which is 0 after the Token::END_OF_INPUT was appended.
+   */
+  size_t ScanBatch(TokenStream* token_stream, size_t max_count);
+
+
+  /**
+   * Start scanning the other source with this scanner.
+   * The all states of the previous source are discarded.
+   * @param begin The front of the new source.
+   * @param end The end of the new source.
+   */
+  void Reset(InputSourceIterator begin, InputSourceIterator end);
+
+
+  /**
+   * The position of the scanner which is saved by the checkpoint().
+   * The decoded current and lookahead characters are saved together,
+   * so the Rewind need not to decode the source again.
+   * The comments which precede the next token are saved too.
+   */
+  struct Checkpoint {
+    InputSourceIterator cursor;
+    InputSourceIterator it;
+    UChar character;
+    UChar lookahead;
+    size_t current_position;
+    size_t line_number;
+    size_t message_size;
+    bool has_line_terminator_before_next;
+    bool end_of_input_scanned;
+    std::vector<CommentRange> comments;
+  };
+
+
+  /**
+   * Save the position after the last scanned token.
    */
-  const TokenInfo* Scan();
+  RASP_INLINE Checkpoint checkpoint() const {
+    return Checkpoint{cursor_, it_, char_, lookahead1_, current_position_, line_number_,
+          message_.size(), has_line_terminator_before_next_, end_of_input_scanned_, comments_};
+  }
+
+
+  /**
+   * Restore the position which is saved by the checkpoint() of the same source,
+   * and the next Scan returns the token after the checkpoint again.
+   * The comments which precede the next token and the last multi line comment are restored,
+   * but the token which is returned after the checkpoint is updated by the next Scan.
+   */
+  RASP_INLINE void Rewind(const Checkpoint& checkpoint) {
+    cursor_ = checkpoint.cursor;
+    it_ = checkpoint.it;
+    char_ = checkpoint.character;
+    lookahead1_ = checkpoint.lookahead;
+    current_position_ = checkpoint.current_position;
+    line_number_ = checkpoint.line_number;
+    message_.resize(checkpoint.message_size);
+    has_line_terminator_before_next_ = checkpoint.has_line_terminator_before_next;
+    end_of_input_scanned_ = checkpoint.end_of_input_scanned;
+    comments_ = checkpoint.comments;
+  }
 
 
   RASP_INLINE bool has_line_terminator_before_next() RASP_NO_SE {
     return has_line_terminator_before_next_;
   }
+
+
+  /**
+   * Tell that the source is the valid utf-8, e.g. validated by SourceStream,
+   * so the raw scanner decodes the non ascii characters without the validation.
+   * This is cleared by Reset.
+   */
+  RASP_INLINE void set_utf8_validated(bool utf8_validated) {
+    utf8_validated_ = utf8_validated;
+  }
   
   
   RASP_INLINE const char* message() const {
@@ -59,17 +242,29 @@ class Scanner {
   }
 
   
-  RASP_INLINE const UtfString& last_multi_line_comment() RASP_NO_SE {
-    return last_multi_line_comment_;
+  /**
+   * The last multi line comment after the last scanned token.
+   * The comment is recorded as the range of the source,
+   * and the value is decoded only when this is called.
+   */
+  RASP_INLINE UtfString last_multi_line_comment() RASP_NO_SE {
+    return comments_.empty()? UtfString(): CommentValue(comments_.back());
   }
 
 
-  RASP_INLINE size_t current_position() RASP_NO_SE {
+  /**
+   * Append the ranges of the multi line comments after the last scanned token to the token_stream.
+   * The comments precede the token which is scanned and appended next.
+   */
+  void AppendComments(TokenStream* token_stream) const;
+
+
+  RASP_INLINE size_t current_position() const {
     return current_position_;
   }
 
   
-  RASP_INLINE size_t line_number() RASP_NO_SE {
+  RASP_INLINE size_t line_number() const {
     return line_number_;
   }
   
@@ -79,21 +274,46 @@ class Scanner {
     line_number_++;
     current_position_ = 1;
   }
+
+
+  /**
+   * Only the raw utf-8 buffer has the LineIndex.
+   */
+  void InitializeLineIndex() {}
+
+
+  typedef const TokenInfo* (Scanner::*ScanFunction)();
+
+  
+  /**
+   * Select the ScanToken which is instantiated for the language mode of the compiler option.
+   */
+  void SelectScanFunction();
+
+
+  /**
+   * The body of the Scan, the language mode dependent branches are resolved on the compile time.
+   */
+  template <LanguageMode kLanguageMode>
+  const TokenInfo* ScanToken();
   
   
   /**
    * Scan string literal.
+   * The escape sequences are validated, but only the unicode and the hex escape sequences are decoded.
    */
   void ScanStringLiteral();
 
   /**
    * Scan digit literal(includes Hex, Double, Integer)
    */
+  template <LanguageMode kLanguageMode>
   void ScanDigit();
 
   /**
    * Scan identifier.
    */
+  template <LanguageMode kLanguageMode>
   void ScanIdentifier();
 
   
@@ -103,11 +323,12 @@ class Scanner {
   void ScanHex();
 
   
+  /**
+   * Scan the punctuator or the operator by the longest match.
+   */
+  template <LanguageMode kLanguageMode>
   void ScanOperator();
 
-  
-  void ScanArithmeticOperator(Token type1, Token type2, Token normal, bool has_let = true);
-
 
   void ScanOctalLiteral();
 
@@ -115,32 +336,37 @@ class Scanner {
   void ScanBinaryLiteral();
   
   
-  bool ScanUnicodeEscapeSequence(UtfString*);
+  /**
+   * Scan the \uXXXX escape sequence and append the character to the value if the value is not null.
+   * @param v The value.
+   * @param uc16 The character of the escape sequence is stored if not null.
+   */
+  bool ScanUnicodeEscapeSequence(UtfString* v, UC16* uc16 = nullptr);
 
 
-  bool ConsumeLineBreak();
+  /**
+   * Scan the escape sequence in the identifier,
+   * the character must be the IdentifierStart at the front of the identifier,
+   * and the IdentifierPart in the rest.
+   */
+  bool ScanIdentifierEscapeSequence(UtfString* v, bool start);
 
 
-  UC16 ScanHexEscape(const UChar& uchar, int len, bool* success);
-  
+  bool ConsumeLineBreak();
 
-  void ScanLogicalOperator(Token type1, Token type2, Token type3) {
-    if (lookahead1_ == char_) {
-      return BuildToken(type1);
-    }
-    if (lookahead1_ == unicode::u8('=')) {
-      return BuildToken(type2);
-    }
-    BuildToken(type3);
-  }
-  
 
-  void ScanBitwiseOrComparationOperator(
-      Token type1, Token type2, Token type3, Token normal, Token equal_comparator, bool has_u = false);
+  /**
+   * Consume the line terminator which is escaped in the string literal.
+   * @param v The string literal value, or nullptr if the value is not needed.
+   */
+  bool ConsumeLineContinuation(UtfString* v);
 
-  
-  void ScanEqualityComparator(bool not = false);
 
+  /**
+   * Scan the len hex digits from the current character.
+   */
+  UC16 ScanHexEscape(int len, bool* success);
+  
 
   bool ScanAsciiEscapeSequence(UtfString* str);
 
@@ -172,12 +398,12 @@ class Scanner {
           Character::IsSingleLineCommentStart(char_, lookahead1_) ||
           Character::IsMultiLineCommentStart(char_, lookahead1_)) {
       if (Character::GetLineBreakType(char_, lookahead1_) != Character::LineBreakType::NONE ||
-          char_ == unicode::u8(';')) {
+          char_ == unicode::u8(';') || Character::IsUnicodeLineTerminator(char_)) {
         has_line_terminator_before_next_ = true;
       }
       skip = true;
       if (!ConsumeLineBreak() && !SkipSingleLineComment() && !SkipMultiLineComment()) {
-        Advance();
+        SkipBlank();
       }
     }
     return skip;
@@ -187,10 +413,7 @@ class Scanner {
   bool SkipSingleLineComment() {
     bool skip = false;
     if (Character::IsSingleLineCommentStart(char_, lookahead1_)) {
-      while (char_ != unicode::u8('\0') &&
-             Character::GetLineBreakType(char_, lookahead1_) == Character::LineBreakType::NONE) {
-        Advance();
-      }
+      SkipToLineTerminator();
       skip = true;
     }
     return skip;
@@ -200,33 +423,51 @@ class Scanner {
   bool SkipMultiLineComment() {
     bool skip = false;
     if (Character::IsMultiLineCommentStart(char_, lookahead1_)) {
-      UtfString str;
-      while (!Character::IsMultiLineCommentEnd(char_, lookahead1_)) {
-        Character::LineBreakType lt = Character::GetLineBreakType(char_, lookahead1_);
-        if (lt != Character::LineBreakType::NONE) {
-          LineFeed();
-          has_line_terminator_before_next_ = true;
-        }
-
-        if (lt == Character::LineBreakType::CRLF) {
-          str += char_;
-          Advance();
-          str += char_;
-          Advance();          
-        } else {
-          str += char_;
-          Advance();
-        }
-      }
-      str += char_;
-      Advance();
-      str += char_;
-      Advance();
+      ScanMultiLineComment();
       skip = true;
-      last_multi_line_comment_ = std::move(str);
     }
     return skip;
   }
+
+
+  /**
+   * Advance to the next line terminator or the end of the input.
+   */
+  void SkipToLineTerminator() {
+    while (char_ != unicode::u8('\0') &&
+           Character::GetLineBreakType(char_, lookahead1_) == Character::LineBreakType::NONE) {
+      Advance();
+    }
+  }
+
+
+  /**
+   * Advance to the next character of the white space or the ';'.
+   */
+  void SkipBlank() {
+    Advance();
+  }
+
+
+  /**
+   * Advance to the next character of the multi line comment,
+   * and record the range of the comment.
+   */
+  void ScanMultiLineComment();
+
+
+  UtfString CommentValue(const CommentRange& range) const;
+
+
+  /**
+   * Advance to the target with counting the column.
+   * The target must be the position of the character in the same line.
+   */
+  void Seek(InputSourceIterator target) {
+    while (cursor_ != target && char_ != unicode::u8('\0')) {
+      Advance();
+    }
+  }
   
 
   void UpdateTokenInfo() {
@@ -246,6 +487,13 @@ class Scanner {
   RASP_INLINE void Illegal() {
     return Error("Illegal token.");
   }
+
+
+  RASP_INLINE void SkipNumericLiteral() {
+    while (Character::IsNumericLiteral(char_)) {
+      Advance();
+    }
+  }
   
 
   void BuildToken(Token type, UtfString utf_string) {
@@ -259,21 +507,74 @@ class Scanner {
     UpdateTokenInfo();
     token_info_.set_type(type);
   }
+
+
+  /**
+   * Build the token which has the value from the start of the builder to the current character.
+   */
+  void BuildToken(Token type, ValueBuilder* builder) {
+    BuildToken(type, std::move(builder->value()));
+  }
+
+
+  /**
+   * Build the numeric literal token and convert the value.
+   * @param prefix_length The length of the prefix such as "0x" which is not the digit.
+   * @param shift The bit width of the one digit, or 0 for the decimal.
+   */
+  void BuildNumericToken(Token type, ValueBuilder* builder, size_t prefix_length, int shift) {
+    BuildToken(type, builder);
+    const char* begin;
+    const char* end;
+    Utf8Value utf8_value(nullptr, 0);
+    if (token_info_.raw_value() != nullptr) {
+      begin = token_info_.raw_value();
+      end = begin + token_info_.raw_length();
+    } else {
+      utf8_value = token_info_.value().ToUtf8Value();
+      begin = utf8_value.value();
+      end = begin + utf8_value.size();
+    }
+    
+    double value;
+    // The legacy octal literal which has 8 or 9 is the decimal.
+    if (shift == 0 || !NumericConversion::ParseRadix(begin + prefix_length, end, shift, &value)) {
+      value = NumericConversion::ParseDecimal(begin, end);
+    }
+    token_info_.set_numeric_value(value);
+  }
   
 
   void Advance();
 
+
+  /**
+   * Read the one character from the raw utf-8 buffer.
+   * @param it The front of the character.
+   * @param end The end of the buffer.
+   * @param validated The buffer is the valid utf-8.
+   * @param uchar The result character.
+   * @return The byte count of the character.
+   */
+  RASP_INLINE static size_t ReadRawChar(const char* it, const char* end, bool validated, UChar* uchar);
+
   
   bool has_line_terminator_before_next_;
+  bool end_of_input_scanned_;
+  bool utf8_validated_;
+  ScanFunction scan_function_;
+  LineIndex line_index_;
   size_t lookahead_cursor_;
   size_t current_position_;
   size_t line_number_;
+  InputSourceIterator begin_;
+  InputSourceIterator cursor_;
   InputSourceIterator it_;
   InputSourceIterator end_;
   TokenInfo token_info_;
   UChar char_;
   UChar lookahead1_;
-  UtfString last_multi_line_comment_;
+  std::vector<CommentRange> comments_;
   std::string message_;
   const CompilerOption& compiler_option_;
 };
@@ -25,25 +25,41 @@
 
 #include <stdio.h>
 #include "sourcestream.h"
+#include "byte-search.h"
 
 namespace rasp {
 
 const char* kCantOpenInput = "Can not open input file: ";
+const char* kInvalidUtf8 = "Invalid utf-8 sequence in input file: ";
+const char* kInvalidUtf16 = "Invalid utf-16 input file: ";
 
-SourceStream::SourceStream(const char* filepath)
-    : MaybeFail() {
+SourceStream::SourceStream(const char* filepath, Encoding encoding)
+    : MaybeFail(),
+      encoding_(encoding),
+      utf8_validated_(false),
+      ascii_(false) {
   Stat stat(filepath);
   bool exists = stat.IsExist();
   filepath_ = filepath;
   if (exists && stat.IsReg()) {
     size_ = stat.Size();
-    if (buffer_.capacity() < size_) {
-      buffer_.reserve(size_ + 1);
-    }
     try {
       FILE* fp = FOpen(filepath, "rb");
-      ReadBlock(fp);
+      if (encoding_ == Encoding::AUTO) {
+        encoding_ = DetectEncoding(fp);
+      }
+      if (utf16()) {
+        ReadUtf16Block(fp);
+      } else {
+        if (buffer_.capacity() < size_) {
+          buffer_.reserve(size_ + 1);
+        }
+        ReadBlock(fp);
+      }
       FClose(fp);
+      if (encoding_ == Encoding::UTF8) {
+        Validate();
+      }
     } catch (const FileIOException& e) {
       Fail() << kCantOpenInput << filepath
              << "\nbecause: " << e.what();
@@ -54,4 +70,57 @@ SourceStream::SourceStream(const char* filepath)
            << "\nbeacause: " << "No such file or directory";
   }
 }
+
+
+SourceStream::Encoding SourceStream::DetectEncoding(FILE* fp) {
+  UC8 bom[2] = {0, 0};
+  size_t read = FRead(bom, sizeof(bom), sizeof(UC8), sizeof(bom), fp);
+  rewind(fp);
+  if (read == 2 && bom[0] == 0xFF && bom[1] == 0xFE) {
+    return Encoding::UTF16LE;
+  } else if (read == 2 && bom[0] == 0xFE && bom[1] == 0xFF) {
+    return Encoding::UTF16BE;
+  }
+  return Encoding::UTF8;
+}
+
+
+void SourceStream::ReadUtf16Block(FILE* fp) {
+  if (size_ % 2 != 0) {
+    Fail() << kInvalidUtf16 << filepath_
+           << "\nbecause: " << "The byte length " << size_ << " is odd";
+    return;
+  }
+  size_t count = size_ / 2;
+  utf16_buffer_.resize(count);
+  if (count == 0) {
+    return;
+  }
+  // The code units are read to the utf-16 buffer as is, so the buffer is not copied.
+  size_t read = FRead(&utf16_buffer_[0], size_, sizeof(UC16), count, fp);
+  utf16_buffer_.resize(read);
+  const UC16 kOne = 1;
+  bool little_endian = *reinterpret_cast<const UC8*>(&kOne) == 1;
+  if (little_endian != (encoding_ == Encoding::UTF16LE)) {
+    for (UC16& uc : utf16_buffer_) {
+      uc = static_cast<UC16>((uc << 8) | (uc >> 8));
+    }
+  }
+}
+
+
+void SourceStream::Validate() {
+  const char* begin = raw_begin();
+  const char* end = raw_end();
+  // The ascii prefix is always valid, so validate only after the first non ascii byte.
+  const char* non_ascii = ByteSearch::FindNonAscii(begin, end);
+  ascii_ = non_ascii == end;
+  const char* invalid = ascii_? end: ByteSearch::FindInvalidUtf8(non_ascii, end);
+  if (invalid != end) {
+    Fail() << kInvalidUtf8 << filepath_
+           << "\nbecause: " << "The byte sequence at the offset " << (invalid - begin) << " is not utf-8";
+    return;
+  }
+  utf8_validated_ = true;
+}
 }
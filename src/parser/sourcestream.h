@@ -39,7 +39,21 @@ namespace rasp {
 class SourceStream : public MaybeFail, private Uncopyable {
  public:
   typedef std::string::iterator iterator;
-  SourceStream(const char* filepath);
+
+  /**
+   * The encoding of the input file.
+   * The AUTO detects the utf-16 by the byte order mark, and the others are utf-8.
+   */
+  enum class Encoding: uint8_t {
+    AUTO,
+    UTF8,
+    UTF16LE,
+    UTF16BE,
+    LATIN1
+  };
+  
+  
+  SourceStream(const char* filepath, Encoding encoding = Encoding::AUTO);
 
   RASP_INLINE ~SourceStream() = default;
   
@@ -53,23 +67,102 @@ class SourceStream : public MaybeFail, private Uncopyable {
   RASP_INLINE const char* buffer() {return buffer_.c_str();}
 
 
+  /**
+   * Return the front of the contiguous utf-8 buffer.
+   * rasp::Scanner<const char*> can scan this buffer without UnicodeIteratorAdapter.
+   */
+  RASP_INLINE const char* raw_begin() const {return buffer_.data();}
+
+
+  /**
+   * Return the end of the contiguous utf-8 buffer.
+   */
+  RASP_INLINE const char* raw_end() const {return buffer_.data() + buffer_.size();}
+
+
   RASP_INLINE size_t size() const {return size_;}
 
 
+  /**
+   * The encoding of the file, which is never the AUTO after the file is loaded.
+   * The buffer of the utf-8 and latin-1 is the raw_begin() and raw_end(),
+   * and the buffer of the utf-16 is the utf16_begin() and utf16_end().
+   */
+  RASP_INLINE Encoding encoding() const {return encoding_;}
+
+
+  RASP_INLINE bool utf16() const {
+    return encoding_ == Encoding::UTF16LE || encoding_ == Encoding::UTF16BE;
+  }
+
+
+  /**
+   * Return the front of the utf-16 buffer in the native byte order, which includes the byte order mark.
+   * rasp::Scanner<CodeUnitIteratorAdapter<UC16>> can scan this buffer without converting to utf-8.
+   */
+  RASP_INLINE const UC16* utf16_begin() const {return utf16_buffer_.data();}
+
+
+  RASP_INLINE const UC16* utf16_end() const {return utf16_buffer_.data() + utf16_buffer_.size();}
+
+
+  /**
+   * Return the front of the latin-1 buffer, which is same as the raw_begin().
+   */
+  RASP_INLINE const UC8* latin1_begin() const {return reinterpret_cast<const UC8*>(raw_begin());}
+
+
+  RASP_INLINE const UC8* latin1_end() const {return reinterpret_cast<const UC8*>(raw_end());}
+
+
+  /**
+   * The whole buffer is validated as utf-8 after the file is loaded,
+   * so the scanner can decode the buffer without the validation.
+   */
+  RASP_INLINE bool utf8_validated() const {return utf8_validated_;}
+
+
+  /**
+   * The buffer has no non ascii byte.
+   */
+  RASP_INLINE bool ascii() const {return ascii_;}
+
+
  private:
   inline void ReadBlock(FILE* fp)  {
     char* buffer = new char[size_ + 1];
-    size_t next = FRead(buffer, size_, sizeof(UC8), size_ - 1, fp);
+    size_t next = FRead(buffer, size_ + 1, sizeof(UC8), size_, fp);
     if (next > 0) {
-      buffer[next] = '\0';
-      buffer_.append(buffer);
+      buffer_.append(buffer, next);
     }
     delete[] buffer;
   }
 
+
+  /**
+   * Read the file to the utf-16 buffer directly, and swap the byte order if it is not native.
+   */
+  void ReadUtf16Block(FILE* fp);
+
+
+  /**
+   * Select the encoding by the byte order mark at the front of the file.
+   */
+  static Encoding DetectEncoding(FILE* fp);
+  
+
+  /**
+   * Validate the buffer by the SIMD kernel, and fail if the buffer is not utf-8.
+   */
+  void Validate();
+
   size_t size_;
+  Encoding encoding_;
+  bool utf8_validated_;
+  bool ascii_;
   std::string filepath_;
   std::string buffer_;
+  Utf16String utf16_buffer_;
 };
 
 }
@@ -0,0 +1,128 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "streaming-scanner.h"
+
+namespace rasp {
+
+static const char kEmptySource[] = "";
+
+
+StreamingScanner::StreamingScanner(const CompilerOption& compiler_option)
+    : scanner_(kEmptySource, kEmptySource, compiler_option),
+      buffer_offset_(0),
+      base_offset_(0),
+      consumed_(0),
+      next_scan_size_(0) {}
+
+
+size_t StreamingScanner::Feed(const char* chunk, size_t size, TokenStream* token_stream) {
+  DiscardConsumed();
+  buffer_.append(chunk, size);
+  size_t complete_size = CompleteSequenceSize();
+  // The tail which does not contain the completed token is scanned again
+  // only after the buffer is doubled, so the long comment or the long token
+  // which is given as the many small chunks is not scanned quadratically.
+  if (complete_size < next_scan_size_) {
+    return 0;
+  }
+  return ScanBuffer(complete_size, false, token_stream);
+}
+
+
+size_t StreamingScanner::Finish(TokenStream* token_stream) {
+  DiscardConsumed();
+  return ScanBuffer(buffer_.size(), true, token_stream);
+}
+
+
+size_t StreamingScanner::ScanBuffer(size_t size, bool end_of_source, TokenStream* token_stream) {
+  const char* begin = buffer_.data();
+  scanned_.Clear();
+  scanner_.Reset(begin, begin + size);
+  scanner_.ScanAll(&scanned_);
+
+  // The last token before the Token::END_OF_INPUT may be continued by the next chunk.
+  // The token before it is completed, but it may be followed by the comment
+  // which is started by the last token, so its line terminator flag is not decided yet.
+  size_t count = scanned_.size();
+  if (!end_of_source) {
+    count = count > 3? count - 3: 0;
+  }
+
+  if (token_stream->empty()) {
+    base_offset_ = buffer_offset_;
+  }
+  size_t delta = buffer_offset_ - base_offset_;
+  size_t token_base = token_stream->size();
+  for (size_t i = 0; i < scanned_.FindComment(count); i++) {
+    token_stream->PushComment(static_cast<uint32_t>(scanned_.comment_offset(i) + delta),
+                              scanned_.comment_length(i),
+                              static_cast<uint32_t>(scanned_.comment_token(i) + token_base));
+  }
+  for (size_t i = 0; i < count; i++) {
+    token_stream->Push(scanned_.type(i),
+                       static_cast<uint32_t>(scanned_.offset(i) + delta),
+                       scanned_.length(i),
+                       scanned_.flags(i),
+                       scanned_.atom(i));
+  }
+
+  if (end_of_source) {
+    consumed_ = buffer_.size();
+  } else if (count > 0) {
+    consumed_ = scanned_.offset(count - 1) + scanned_.length(count - 1);
+  } else {
+    consumed_ = 0;
+  }
+  next_scan_size_ = (buffer_.size() - consumed_) * 2;
+  return count;
+}
+
+
+void StreamingScanner::DiscardConsumed() {
+  if (consumed_ > 0) {
+    buffer_.erase(0, consumed_);
+    buffer_offset_ += consumed_;
+    consumed_ = 0;
+  }
+}
+
+
+size_t StreamingScanner::CompleteSequenceSize() const {
+  size_t size = buffer_.size();
+  // Find the lead byte of the last utf-8 byte sequence.
+  size_t lead = size;
+  while (lead > 0 && size - lead < 4) {
+    --lead;
+    if ((static_cast<uint8_t>(buffer_[lead]) & 0xC0) != 0x80) {
+      if (lead + utf8::GetByteCount(static_cast<uint8_t>(buffer_[lead])) > size) {
+        return lead;
+      }
+      break;
+    }
+  }
+  return size;
+}
+}
@@ -0,0 +1,121 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_STREAMING_SCANNER_H_
+#define PARSER_STREAMING_SCANNER_H_
+
+#include <string>
+#include "scanner.h"
+#include "token-stream.h"
+#include "../compiler-option.h"
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * Scan the utf-8 source which is given as the sequence of the chunks.
+ * The token which touches the end of the given chunks is not emitted until the next chunk arrives,
+ * because the next chunk may continue the token, the string literal, the comment
+ * or the utf-8 byte sequence. Such tail is kept and scanned again with the next chunk,
+ * so only the incomplete tail and the last chunk are held in the memory.
+ *
+ * The offsets of the emitted tokens are counted from the base_offset(),
+ * which is the source offset of the first token that is appended to the empty token_stream.
+ * So the caller which clears the token_stream after consuming it can scan
+ * the source which is larger than the uint32_t offset of the TokenStream.
+ */
+class StreamingScanner : private Uncopyable {
+ public:
+  explicit StreamingScanner(const CompilerOption& compiler_option);
+
+
+  /**
+   * Scan the chunk and append the tokens which are completed so far to the token_stream.
+   * @return The count of the appended tokens.
+   */
+  size_t Feed(const char* chunk, size_t size, TokenStream* token_stream);
+
+
+  /**
+   * Scan the remaining tail as the end of the source and append the rest of the tokens.
+   * The last token is the Token::END_OF_INPUT.
+   * @return The count of the appended tokens.
+   */
+  size_t Finish(TokenStream* token_stream);
+
+
+  /**
+   * The source offset which the offsets of the token_stream are counted from.
+   */
+  RASP_INLINE size_t base_offset() const {
+    return base_offset_;
+  }
+
+
+  /**
+   * The source bytes which are scanned by the last Feed or Finish.
+   * The text of the tokens which are appended by the last call is kept until the next call.
+   */
+  RASP_INLINE const char* buffer() const {
+    return buffer_.data();
+  }
+
+
+  /**
+   * The source offset of the buffer().
+   */
+  RASP_INLINE size_t buffer_offset() const {
+    return buffer_offset_;
+  }
+
+ private:
+  /**
+   * Scan the first size bytes of the buffer and emit the completed tokens.
+   * @param end_of_source true if the size bytes are the all remaining source.
+   */
+  size_t ScanBuffer(size_t size, bool end_of_source, TokenStream* token_stream);
+
+
+  /**
+   * Remove the bytes which are consumed by the last call from the buffer.
+   */
+  void DiscardConsumed();
+
+
+  /**
+   * Return the size of the buffer without the incomplete utf-8 byte sequence at the end.
+   */
+  size_t CompleteSequenceSize() const;
+  
+  Scanner<const char*> scanner_;
+  TokenStream scanned_;
+  std::string buffer_;
+  size_t buffer_offset_;
+  size_t base_offset_;
+  size_t consumed_;
+  size_t next_scan_size_;
+};
+}
+
+#endif
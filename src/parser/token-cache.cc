@@ -0,0 +1,282 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include "token-cache.h"
+#include "atom-table.h"
+#include "scanner.h"
+#include "../utils/mapped-file.h"
+#include "../utils/os.h"
+
+namespace rasp {
+
+namespace {
+static const char kMagic[] = {'R', 'T', 'K', 'C'};
+static const uint64_t kVersion = 2;
+static const uint64_t kMinTokenSize = 4;
+
+
+void WriteVarint(uint64_t value, std::string* buffer) {
+  while (value >= 0x80) {
+    buffer->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  buffer->push_back(static_cast<char>(value));
+}
+
+
+bool ReadVarint(const char** it, const char* end, uint64_t* value) {
+  uint64_t result = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (*it == end) {
+      return false;
+    }
+    uint8_t byte = static_cast<uint8_t>(**it);
+    ++(*it);
+    result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+
+/**
+ * Moves the position past a span that starts delta bytes after it.
+ * Returns false if the span does not fit in the source or in the uint32 offsets
+ * of the TokenStream, checking before each sum so that a corrupt file cannot wrap.
+ */
+bool AdvanceSpan(uint64_t size, uint64_t delta, uint64_t length, uint64_t* position) {
+  if (delta > size - *position) {
+    return false;
+  }
+  uint64_t offset = *position + delta;
+  if (length > size - offset || offset + length > UINT32_MAX) {
+    return false;
+  }
+  *position = offset + length;
+  return true;
+}
+
+
+/**
+ * The atom is the process local id, so it is not stored in the cache file
+ * and the identifier is interned again with the same bytes as the scanner interns.
+ */
+Atom InternIdentifier(const char* source, uint32_t offset, uint32_t length, bool has_escapes) {
+  const char* value = source + offset;
+  if (has_escapes) {
+    UtfString decoded = TokenInfo::DecodeEscapeSequences(value, value + length);
+    Utf8Value utf8_value = decoded.ToUtf8Value();
+    return AtomTable::Default()->Intern(utf8_value.value(), utf8_value.size());
+  }
+  return AtomTable::Default()->Intern(value, length);
+}
+}
+
+
+bool TokenCache::Load(const char* source, size_t size, LanguageMode language_mode, TokenStream* token_stream) const {
+  uint64_t hash = ContentHash(source, size);
+  MappedFile file(CachePath(hash, language_mode).c_str());
+  if (!file.IsOpen() || file.size() < sizeof(kMagic) ||
+      memcmp(file.data(), kMagic, sizeof(kMagic)) != 0) {
+    return false;
+  }
+
+  const char* it = file.data() + sizeof(kMagic);
+  const char* end = file.data() + file.size();
+  uint64_t version;
+  uint64_t mode;
+  uint64_t source_size;
+  uint64_t content_hash;
+  uint64_t count;
+  if (!ReadVarint(&it, end, &version) || version != kVersion ||
+      !ReadVarint(&it, end, &mode) || mode != static_cast<uint64_t>(language_mode) ||
+      !ReadVarint(&it, end, &source_size) || source_size != size ||
+      !ReadVarint(&it, end, &content_hash) || content_hash != hash ||
+      !ReadVarint(&it, end, &count)) {
+    return false;
+  }
+
+  // A token takes at least one byte for each of the type, delta, length and flags,
+  // so a count beyond that is a corrupt file and must not size the reservation.
+  if (count > static_cast<uint64_t>(end - it) / kMinTokenSize) {
+    return false;
+  }
+
+  size_t initial_size = token_stream->size();
+  token_stream->Reserve(initial_size + count);
+  uint64_t position = 0;
+  for (uint64_t i = 0; i < count; i++) {
+    uint64_t type;
+    uint64_t delta;
+    uint64_t length;
+    if (!ReadVarint(&it, end, &type) || type > static_cast<uint64_t>(Token::ILLEGAL) ||
+        !ReadVarint(&it, end, &delta) ||
+        !ReadVarint(&it, end, &length) ||
+        it == end) {
+      break;
+    }
+    uint8_t flags = static_cast<uint8_t>(*it++);
+    if (!AdvanceSpan(size, delta, length, &position)) {
+      break;
+    }
+    uint64_t offset = position - length;
+    Token token = static_cast<Token>(type);
+    Atom atom = AtomTable::kInvalidAtom;
+    if (token == Token::JS_IDENTIFIER) {
+      atom = InternIdentifier(source, static_cast<uint32_t>(offset), static_cast<uint32_t>(length),
+                              (flags & TokenStream::kHasEscapes) != 0);
+    }
+    token_stream->Push(token, static_cast<uint32_t>(offset), static_cast<uint32_t>(length), flags, atom);
+  }
+
+  uint64_t comment_count;
+  if (token_stream->size() - initial_size != count || !ReadVarint(&it, end, &comment_count)) {
+    token_stream->Truncate(initial_size);
+    return false;
+  }
+  uint64_t comment_position = 0;
+  uint64_t comment_token = 0;
+  uint64_t loaded_comment_count = 0;
+  for (; loaded_comment_count < comment_count; loaded_comment_count++) {
+    uint64_t token_delta;
+    uint64_t delta;
+    uint64_t length;
+    if (!ReadVarint(&it, end, &token_delta) ||
+        !ReadVarint(&it, end, &delta) ||
+        !ReadVarint(&it, end, &length)) {
+      break;
+    }
+    if (token_delta >= count - comment_token ||
+        !AdvanceSpan(size, delta, length, &comment_position)) {
+      break;
+    }
+    comment_token += token_delta;
+    uint64_t offset = comment_position - length;
+    token_stream->PushComment(static_cast<uint32_t>(offset), static_cast<uint32_t>(length),
+                              static_cast<uint32_t>(initial_size + comment_token));
+  }
+
+  if (loaded_comment_count != comment_count || it != end) {
+    token_stream->Truncate(initial_size);
+    return false;
+  }
+  return true;
+}
+
+
+bool TokenCache::Store(const char* source, size_t size, LanguageMode language_mode, const TokenStream& token_stream) const {
+  std::string buffer(kMagic, sizeof(kMagic));
+  uint64_t hash = ContentHash(source, size);
+  WriteVarint(kVersion, &buffer);
+  WriteVarint(static_cast<uint64_t>(language_mode), &buffer);
+  WriteVarint(size, &buffer);
+  WriteVarint(hash, &buffer);
+  WriteVarint(token_stream.size(), &buffer);
+
+  uint32_t position = 0;
+  for (size_t i = 0; i < token_stream.size(); i++) {
+    WriteVarint(static_cast<uint64_t>(token_stream.type(i)), &buffer);
+    WriteVarint(token_stream.offset(i) - position, &buffer);
+    WriteVarint(token_stream.length(i), &buffer);
+    buffer.push_back(static_cast<char>(token_stream.flags(i)));
+    position = token_stream.offset(i) + token_stream.length(i);
+  }
+
+  WriteVarint(token_stream.comment_count(), &buffer);
+  position = 0;
+  uint32_t comment_token = 0;
+  for (size_t i = 0; i < token_stream.comment_count(); i++) {
+    WriteVarint(token_stream.comment_token(i) - comment_token, &buffer);
+    WriteVarint(token_stream.comment_offset(i) - position, &buffer);
+    WriteVarint(token_stream.comment_length(i), &buffer);
+    comment_token = token_stream.comment_token(i);
+    position = token_stream.comment_offset(i) + token_stream.comment_length(i);
+  }
+
+  std::string path = CachePath(hash, language_mode);
+  std::stringstream temporary_path;
+  temporary_path << path << '.' << std::hash<std::thread::id>()(std::this_thread::get_id()) << ".tmp";
+  try {
+    FILE* fp = FOpen(temporary_path.str().c_str(), "wb");
+    size_t written = fwrite(buffer.data(), sizeof(char), buffer.size(), fp);
+    FClose(fp);
+    if (written != buffer.size()) {
+      std::remove(temporary_path.str().c_str());
+      return false;
+    }
+  } catch (const FileIOException& e) {
+    return false;
+  }
+  if (std::rename(temporary_path.str().c_str(), path.c_str()) != 0) {
+    std::remove(temporary_path.str().c_str());
+    return false;
+  }
+  return true;
+}
+
+
+bool TokenCache::Tokenize(const char* source, size_t size, const CompilerOption& compiler_option, TokenStream* token_stream) const {
+  if (Load(source, size, compiler_option.language_mode(), token_stream)) {
+    return true;
+  }
+  TokenStream scanned;
+  Scanner<const char*> scanner(source, source + size, compiler_option);
+  scanner.ScanAll(&scanned);
+  Store(source, size, compiler_option.language_mode(), scanned);
+  token_stream->Append(scanned);
+  return false;
+}
+
+
+std::string TokenCache::CachePath(const char* source, size_t size, LanguageMode language_mode) const {
+  return CachePath(ContentHash(source, size), language_mode);
+}
+
+
+std::string TokenCache::CachePath(uint64_t hash, LanguageMode language_mode) const {
+  std::string path;
+  SPrintf(path, false, "%s/%016llx-%d.tokens", directory_.c_str(),
+          static_cast<unsigned long long>(hash), static_cast<int>(language_mode));
+  return path;
+}
+
+
+// FNV-1a
+uint64_t TokenCache::ContentHash(const char* source, size_t size) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= static_cast<uint8_t>(source[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+}
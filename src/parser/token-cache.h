@@ -0,0 +1,104 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_TOKEN_CACHE_H_
+#define PARSER_TOKEN_CACHE_H_
+
+#include <string>
+#include "sourcestream.h"
+#include "token-stream.h"
+#include "../compiler-option.h"
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * The on-disk cache of the scanned tokens.
+ * The cache file is created per source, and is keyed by the content hash of the source
+ * and the language mode, so the unchanged source is never scanned again.
+ * The tokens are stored as the varint encoded stream,
+ * the offset of the token is encoded as the delta from the end of the previous token.
+ * The comment ranges follow the tokens in the same way.
+ * The cache file is memory mapped and decoded into the TokenStream directly.
+ */
+class TokenCache : private Uncopyable {
+ public:
+  /**
+   * @param directory The directory which the cache files are written in. It must exist.
+   */
+  explicit TokenCache(const char* directory)
+      : directory_(directory) {}
+
+
+  /**
+   * Restore the tokens of the source from the cache file.
+   * @return false if the cache file is not found or is not valid for the source.
+   */
+  bool Load(const char* source, size_t size, LanguageMode language_mode, TokenStream* token_stream) const;
+
+
+  /**
+   * Write the tokens of the source to the cache file.
+   * The file is written to the temporary file at first and renamed,
+   * so the other process never reads the partially written file.
+   * @return false if the cache file could not be written.
+   */
+  bool Store(const char* source, size_t size, LanguageMode language_mode, const TokenStream& token_stream) const;
+
+
+  /**
+   * Restore the tokens from the cache file, or scan the source and store the tokens if not cached.
+   * @return true if the tokens are restored from the cache file.
+   */
+  bool Tokenize(const char* source, size_t size, const CompilerOption& compiler_option, TokenStream* token_stream) const;
+
+
+  RASP_INLINE bool Tokenize(const SourceStream& source_stream,
+                            const CompilerOption& compiler_option,
+                            TokenStream* token_stream) const {
+    return Tokenize(source_stream.raw_begin(),
+                    source_stream.raw_end() - source_stream.raw_begin(),
+                    compiler_option, token_stream);
+  }
+
+
+  /**
+   * The path of the cache file for the source.
+   */
+  std::string CachePath(const char* source, size_t size, LanguageMode language_mode) const;
+
+
+  /**
+   * The 64-bit FNV-1a hash of the source.
+   */
+  static uint64_t ContentHash(const char* source, size_t size);
+
+ private:
+  std::string CachePath(uint64_t hash, LanguageMode language_mode) const;
+  
+  std::string directory_;
+};
+}
+
+#endif
@@ -0,0 +1,336 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARSER_TOKEN_STREAM_H_
+#define PARSER_TOKEN_STREAM_H_
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "atom-table.h"
+#include "token.h"
+#include "../utils/regions.h"
+#include "../utils/utils.h"
+
+namespace rasp {
+
+/**
+ * The token sequence which is stored as the struct of arrays.
+ * Each property of the tokens is packed in the separated array,
+ * so the consumer which reads only the token types touches only the type array.
+ * The offset and the length are counted by the unit of the scanner input,
+ * which is the byte for the raw utf-8 buffer.
+ * They are stored as uint32_t, so the source must not exceed kMaxSourceSize.
+ * The multi line comments are stored as the ranges in the side table,
+ * each comment has the index of the token which follows it.
+ */
+class TokenStream {
+ public:
+  enum Flag: uint8_t {
+    kNone = 0,
+    kLineTerminatorBeforeNext = 1,
+    kHasEscapes = 2
+  };
+
+  /**
+   * The average byte count of the one token, which is measured from the common libraries.
+   */
+  static const size_t kBytesPerToken = 6;
+
+  /**
+   * The max size of the source whose offsets fit in the uint32_t arrays, which is 4GB - 1.
+   */
+  static const size_t kMaxSourceSize = std::numeric_limits<uint32_t>::max();
+
+  /**
+   * @param source_size The byte size of the source which is used to estimate the token count.
+   * @param regions The Regions which the arrays are allocated from,
+   *                the arrays are allocated from the heap if nullptr.
+   */
+  explicit TokenStream(size_t source_size = 0, Regions* regions = nullptr)
+      : types_(Allocator<Token>(regions)),
+        offsets_(Allocator<uint32_t>(regions)),
+        lengths_(Allocator<uint32_t>(regions)),
+        atoms_(Allocator<Atom>(regions)),
+        flags_(Allocator<uint8_t>(regions)),
+        comment_offsets_(Allocator<uint32_t>(regions)),
+        comment_lengths_(Allocator<uint32_t>(regions)),
+        comment_tokens_(Allocator<uint32_t>(regions)) {
+    if (source_size > 0) {
+      Reserve(EstimateTokenCount(source_size));
+    }
+  }
+
+
+  RASP_INLINE static size_t EstimateTokenCount(size_t source_size) {
+    return source_size / kBytesPerToken + 1;
+  }
+
+
+  void Reserve(size_t count) {
+    types_.reserve(count);
+    offsets_.reserve(count);
+    lengths_.reserve(count);
+    atoms_.reserve(count);
+    flags_.reserve(count);
+  }
+
+
+  /**
+   * Append the token which is just scanned.
+   */
+  RASP_INLINE void Push(const TokenInfo& token_info, bool has_line_terminator_before_next) {
+    ASSERT(true, token_info.source_offset() + token_info.source_length() <= kMaxSourceSize);
+    types_.push_back(token_info.type());
+    offsets_.push_back(static_cast<uint32_t>(token_info.source_offset()));
+    lengths_.push_back(static_cast<uint32_t>(token_info.source_length()));
+    atoms_.push_back(token_info.atom());
+    uint8_t flags = kNone;
+    if (has_line_terminator_before_next) {
+      flags |= kLineTerminatorBeforeNext;
+    }
+    if (HasValue(token_info.type()) && token_info.raw_value() != nullptr && token_info.has_escapes()) {
+      flags |= kHasEscapes;
+    }
+    flags_.push_back(flags);
+  }
+
+
+  /**
+   * Append the token which is restored from the serialized stream.
+   */
+  RASP_INLINE void Push(Token type, uint32_t offset, uint32_t length, uint8_t flags, Atom atom) {
+    types_.push_back(type);
+    offsets_.push_back(offset);
+    lengths_.push_back(length);
+    atoms_.push_back(atom);
+    flags_.push_back(flags);
+  }
+
+
+  /**
+   * Append the range of the multi line comment which precedes the token that is appended next.
+   */
+  RASP_INLINE void PushComment(uint32_t offset, uint32_t length) {
+    PushComment(offset, length, static_cast<uint32_t>(size()));
+  }
+
+
+  /**
+   * Append the range of the multi line comment which precedes the token of the index.
+   * The comments must be appended in the order of the source.
+   */
+  RASP_INLINE void PushComment(uint32_t offset, uint32_t length, uint32_t token) {
+    comment_offsets_.push_back(offset);
+    comment_lengths_.push_back(length);
+    comment_tokens_.push_back(token);
+  }
+
+
+  /**
+   * Append the all tokens and the all comments of the other stream.
+   */
+  void Append(const TokenStream& token_stream) {
+    AppendComments(token_stream, 0);
+    Append(token_stream, 0, token_stream.size());
+  }
+
+
+  /**
+   * Append the tokens in the range [begin, end) of the other stream and the comments between them.
+   * The comments before the begin are not appended, they are appended by the AppendComments.
+   */
+  void Append(const TokenStream& token_stream, size_t begin, size_t end) {
+    size_t comment_begin = token_stream.FindComment(begin + 1);
+    size_t comment_end = token_stream.FindComment(end);
+    for (size_t i = comment_begin; i < comment_end; i++) {
+      PushComment(token_stream.comment_offsets_[i], token_stream.comment_lengths_[i],
+                  static_cast<uint32_t>(token_stream.comment_tokens_[i] - begin + size()));
+    }
+    types_.insert(types_.end(), token_stream.types_.begin() + begin, token_stream.types_.begin() + end);
+    offsets_.insert(offsets_.end(), token_stream.offsets_.begin() + begin, token_stream.offsets_.begin() + end);
+    lengths_.insert(lengths_.end(), token_stream.lengths_.begin() + begin, token_stream.lengths_.begin() + end);
+    atoms_.insert(atoms_.end(), token_stream.atoms_.begin() + begin, token_stream.atoms_.begin() + end);
+    flags_.insert(flags_.end(), token_stream.flags_.begin() + begin, token_stream.flags_.begin() + end);
+  }
+
+
+  /**
+   * Append the comments which precede the token of the index in the other stream,
+   * as the comments which precede the token that is appended next.
+   */
+  void AppendComments(const TokenStream& token_stream, size_t index) {
+    for (size_t i = token_stream.FindComment(index);
+         i < token_stream.comment_count() && token_stream.comment_tokens_[i] == index; i++) {
+      PushComment(token_stream.comment_offsets_[i], token_stream.comment_lengths_[i]);
+    }
+  }
+
+
+  /**
+   * Remove the tokens after the size and the comments which precede them.
+   */
+  void Truncate(size_t size) {
+    types_.resize(size);
+    offsets_.resize(size);
+    lengths_.resize(size);
+    atoms_.resize(size);
+    flags_.resize(size);
+    size_t comment_count = FindComment(size);
+    comment_offsets_.resize(comment_count);
+    comment_lengths_.resize(comment_count);
+    comment_tokens_.resize(comment_count);
+  }
+
+
+  void Clear() {
+    types_.clear();
+    offsets_.clear();
+    lengths_.clear();
+    atoms_.clear();
+    flags_.clear();
+    comment_offsets_.clear();
+    comment_lengths_.clear();
+    comment_tokens_.clear();
+  }
+
+
+  RASP_INLINE size_t size() const {
+    return types_.size();
+  }
+
+
+  RASP_INLINE bool empty() const {
+    return types_.empty();
+  }
+
+
+  RASP_INLINE Token type(size_t index) const {
+    return types_[index];
+  }
+
+
+  RASP_INLINE uint32_t offset(size_t index) const {
+    return offsets_[index];
+  }
+
+
+  RASP_INLINE uint32_t length(size_t index) const {
+    return lengths_[index];
+  }
+
+
+  /**
+   * The atom of the identifier or AtomTable::kInvalidAtom.
+   */
+  RASP_INLINE Atom atom(size_t index) const {
+    return atoms_[index];
+  }
+
+
+  RASP_INLINE uint8_t flags(size_t index) const {
+    return flags_[index];
+  }
+
+
+  RASP_INLINE bool has_line_terminator_before_next(size_t index) const {
+    return (flags_[index] & kLineTerminatorBeforeNext) != 0;
+  }
+
+
+  RASP_INLINE bool has_escapes(size_t index) const {
+    return (flags_[index] & kHasEscapes) != 0;
+  }
+
+
+  RASP_INLINE const Token* types() const {
+    return types_.data();
+  }
+
+
+  RASP_INLINE const uint32_t* offsets() const {
+    return offsets_.data();
+  }
+
+
+  RASP_INLINE const uint32_t* lengths() const {
+    return lengths_.data();
+  }
+
+
+  RASP_INLINE size_t comment_count() const {
+    return comment_offsets_.size();
+  }
+
+
+  RASP_INLINE uint32_t comment_offset(size_t index) const {
+    return comment_offsets_[index];
+  }
+
+
+  RASP_INLINE uint32_t comment_length(size_t index) const {
+    return comment_lengths_[index];
+  }
+
+
+  /**
+   * The index of the token which follows the comment.
+   */
+  RASP_INLINE uint32_t comment_token(size_t index) const {
+    return comment_tokens_[index];
+  }
+
+
+  /**
+   * Find the first comment which precedes the token of the index or the tokens after it.
+   * @return The index of the comment or comment_count() if not found.
+   */
+  RASP_INLINE size_t FindComment(size_t token) const {
+    return std::lower_bound(comment_tokens_.begin(), comment_tokens_.end(), token) - comment_tokens_.begin();
+  }
+  
+ private:
+  RASP_INLINE static bool HasValue(Token type) {
+    return type == Token::JS_IDENTIFIER || type == Token::JS_STRING_LITERAL;
+  }
+  
+  template <typename T>
+  using Allocator = Regions::RegionsStandardAllocator<T>;
+  
+  template <typename T>
+  using Array = std::vector<T, Allocator<T>>;
+  
+  Array<Token> types_;
+  Array<uint32_t> offsets_;
+  Array<uint32_t> lengths_;
+  Array<Atom> atoms_;
+  Array<uint8_t> flags_;
+  Array<uint32_t> comment_offsets_;
+  Array<uint32_t> comment_lengths_;
+  Array<uint32_t> comment_tokens_;
+};
+
+}
+
+#endif
@@ -23,210 +23,62 @@
  */
 
 
+#include <algorithm>
 #include <type_traits>
+#include <boost/preprocessor/repetition/enum.hpp>
 #include "../utils/utils.h"
 #include "token.h"
 
 namespace rasp {
 
 
-static const Token kPunctures[] = {
-  Token::ILLEGAL,// 0
-  Token::ILLEGAL,// 1
-  Token::ILLEGAL,// 2
-  Token::ILLEGAL,// 3
-  Token::ILLEGAL,// 4
-  Token::ILLEGAL,// 5
-  Token::ILLEGAL,// 6
-  Token::ILLEGAL,// 7
-  Token::ILLEGAL,// 8
-  Token::ILLEGAL,// 9
-  Token::ILLEGAL,// 10
-  Token::ILLEGAL,// 11
-  Token::ILLEGAL,// 12
-  Token::ILLEGAL,// 13
-  Token::ILLEGAL,// 14
-  Token::ILLEGAL,// 15
-  Token::ILLEGAL,// 16
-  Token::ILLEGAL,// 17
-  Token::ILLEGAL,// 18
-  Token::ILLEGAL,// 19
-  Token::ILLEGAL,// 20
-  Token::ILLEGAL,// 21
-  Token::ILLEGAL,// 22
-  Token::ILLEGAL,// 23
-  Token::ILLEGAL,// 24
-  Token::ILLEGAL,// 25
-  Token::ILLEGAL,// 26
-  Token::ILLEGAL,// 27
-  Token::ILLEGAL,// 28
-  Token::ILLEGAL,// 29
-  Token::ILLEGAL,// 30
-  Token::ILLEGAL,// 31
-  Token::ILLEGAL,// 32
-  Token::ILLEGAL,// 33 !
-  Token::ILLEGAL,// 34 '
-  Token::ILLEGAL,// 35 #
-  Token::ILLEGAL,// 36 $
-  Token::ILLEGAL,// 37 %
-  Token::ILLEGAL,// 38 &
-  Token::ILLEGAL,// 39 '
-  Token::JS_LEFT_PAREN,// 40 (
-  Token::JS_RIGHT_PAREN,// 41 )
-  Token::ILLEGAL,// 42 *
-  Token::ILLEGAL,// 43 +
-  Token::ILLEGAL,// 44 ,
-  Token::ILLEGAL,// 45 -
-  Token::ILLEGAL,// 46 .
-  Token::ILLEGAL,// 47 /
-  Token::ILLEGAL,// 48 0
-  Token::ILLEGAL,// 49 1
-  Token::ILLEGAL,// 50 2
-  Token::ILLEGAL,// 51 3
-  Token::ILLEGAL,// 52 4
-  Token::ILLEGAL,// 53 5
-  Token::ILLEGAL,// 54 6
-  Token::ILLEGAL,// 55 7
-  Token::ILLEGAL,// 56 8
-  Token::ILLEGAL,// 57 9
-  Token::JS_COLON,// 58 :
-  Token::ILLEGAL,// 59 ;
-  Token::ILLEGAL,// 60 <
-  Token::ILLEGAL,// 61 =
-  Token::ILLEGAL,// 62 >
-  Token::JS_QUESTION_MARK,// 63 ?
-  Token::ILLEGAL,// 64 @
-  Token::ILLEGAL,// 65 A
-  Token::ILLEGAL,// 66 B
-  Token::ILLEGAL,// 67 C
-  Token::ILLEGAL,// 68 D
-  Token::ILLEGAL,// 69 E
-  Token::ILLEGAL,// 70 F
-  Token::ILLEGAL,// 71 G
-  Token::ILLEGAL,// 72 H
-  Token::ILLEGAL,// 73 I
-  Token::ILLEGAL,// 74 J
-  Token::ILLEGAL,// 75 K
-  Token::ILLEGAL,// 76 L
-  Token::ILLEGAL,// 77 M
-  Token::ILLEGAL,// 78 N
-  Token::ILLEGAL,// 79 O
-  Token::ILLEGAL,// 80 P
-  Token::ILLEGAL,// 81 Q
-  Token::ILLEGAL,// 82 R
-  Token::ILLEGAL,// 83 S
-  Token::ILLEGAL,// 84 T
-  Token::ILLEGAL,// 85 U
-  Token::ILLEGAL,// 86 V
-  Token::ILLEGAL,// 87 W
-  Token::ILLEGAL,// 88 X
-  Token::ILLEGAL,// 89 Y
-  Token::ILLEGAL,// 90 Z
-  Token::JS_LEFT_BRACKET,// 91 [
-  Token::ILLEGAL,// 92 BACK_SLASH
-  Token::JS_RIGHT_BRACKET,// 93 ]
-  Token::ILLEGAL,// 94 ^
-  Token::ILLEGAL,// 95 _
-  Token::ILLEGAL,// 96 `
-  Token::ILLEGAL,// 97 a
-  Token::ILLEGAL,// 98 b
-  Token::ILLEGAL,// 99 c
-  Token::ILLEGAL,// 100 d
-  Token::ILLEGAL,// 101 e
-  Token::ILLEGAL,// 102 f
-  Token::ILLEGAL,// 103 g
-  Token::ILLEGAL,// 104 h
-  Token::ILLEGAL,// 105 i
-  Token::ILLEGAL,// 106 j
-  Token::ILLEGAL,// 107 k
-  Token::ILLEGAL,// 108 l
-  Token::ILLEGAL,// 109 m
-  Token::ILLEGAL,// 110 n
-  Token::ILLEGAL,// 111 o
-  Token::ILLEGAL,// 112 p
-  Token::ILLEGAL,// 113 q
-  Token::ILLEGAL,// 114 r
-  Token::ILLEGAL,// 115 s
-  Token::ILLEGAL,// 116 t
-  Token::ILLEGAL,// 117 u
-  Token::ILLEGAL,// 118 v
-  Token::ILLEGAL,// 119 w
-  Token::ILLEGAL,// 120 x
-  Token::ILLEGAL,// 121 y
-  Token::ILLEGAL,// 122 z
-  Token::JS_LEFT_BRACE,// 123 {
-  Token::ILLEGAL,// 124 |
-  Token::JS_RIGHT_BRACE,// 125 }
-  Token::ILLEGAL,// 126 ~
-  Token::ILLEGAL // 127 DEL
-};
-
-
-
-#define KEYWORDS(KEYWORD_GROUP, KEYWORD)                                \
-  KEYWORD_GROUP('b')                                                    \
+#define KEYWORDS(KEYWORD)                                               \
   KEYWORD("break", Token::JS_BREAK)                                     \
-  KEYWORD_GROUP('c')                                                    \
   KEYWORD("case", Token::JS_CASE)                                       \
   KEYWORD("catch", Token::JS_CATCH)                                     \
   KEYWORD("class", Token::FUTURE_RESERVED_WORD)                         \
   KEYWORD("const", Token::JS_CONST)                                     \
   KEYWORD("continue", Token::JS_CONTINUE)                               \
-  KEYWORD_GROUP('d')                                                    \
   KEYWORD("debugger", Token::JS_DEBUGGER)                               \
   KEYWORD("default", Token::JS_DEFAULT)                                 \
   KEYWORD("delete", Token::JS_DELETE)                                   \
   KEYWORD("do", Token::JS_DO)                                           \
-  KEYWORD_GROUP('e')                                                    \
   KEYWORD("else", Token::JS_ELSE)                                       \
   KEYWORD("enum", Token::FUTURE_RESERVED_WORD)                          \
   KEYWORD("export", es_harmony? Token::JS_EXPORT: Token::FUTURE_RESERVED_WORD) \
   KEYWORD("extends", Token::FUTURE_RESERVED_WORD)                       \
-  KEYWORD_GROUP('f')                                                    \
   KEYWORD("false", Token::JS_FALSE)                                     \
   KEYWORD("finally", Token::JS_FINALLY)                                 \
   KEYWORD("for", Token::JS_FOR)                                         \
   KEYWORD("function", Token::JS_FUNCTION)                               \
-  KEYWORD_GROUP('i')                                                    \
   KEYWORD("if", Token::JS_IF)                                           \
   KEYWORD("implements", Token::FUTURE_STRICT_RESERVED_WORD)             \
   KEYWORD("import", es_harmony? Token::JS_IMPORT: Token::FUTURE_RESERVED_WORD) \
   KEYWORD("in", Token::JS_IN)                                           \
   KEYWORD("instanceof", Token::JS_INSTANCEOF)                           \
   KEYWORD("interface", Token::FUTURE_STRICT_RESERVED_WORD)              \
-  KEYWORD_GROUP('l')                                                    \
   KEYWORD("let", es_harmony? Token::JS_LET: Token::FUTURE_STRICT_RESERVED_WORD) \
-  KEYWORD_GROUP('n')                                                    \
   KEYWORD("new", Token::JS_NEW)                                         \
   KEYWORD("null", Token::JS_NULL)                                       \
-  KEYWORD_GROUP('N')                                                    \
   KEYWORD("NaN", Token::JS_NAN)                                         \
-  KEYWORD_GROUP('p')                                                    \
   KEYWORD("package", Token::FUTURE_STRICT_RESERVED_WORD)                \
   KEYWORD("private", Token::FUTURE_STRICT_RESERVED_WORD)                \
   KEYWORD("protected", Token::FUTURE_STRICT_RESERVED_WORD)              \
   KEYWORD("public", Token::FUTURE_STRICT_RESERVED_WORD)                 \
-  KEYWORD_GROUP('r')                                                    \
   KEYWORD("return", Token::JS_RETURN)                                   \
-  KEYWORD_GROUP('s')                                                    \
   KEYWORD("static", Token::FUTURE_STRICT_RESERVED_WORD)                 \
   KEYWORD("super", Token::FUTURE_RESERVED_WORD)                         \
   KEYWORD("switch", Token::JS_SWITCH)                                   \
-  KEYWORD_GROUP('t')                                                    \
   KEYWORD("this", Token::JS_THIS)                                       \
   KEYWORD("throw", Token::JS_THROW)                                     \
   KEYWORD("true", Token::JS_TRUE)                                       \
   KEYWORD("try", Token::JS_TRY)                                         \
   KEYWORD("typeof", Token::JS_TYPEOF)                                   \
-  KEYWORD_GROUP('u')                                                    \
   KEYWORD("undefined", Token::JS_UNDEFINED)                             \
-  KEYWORD_GROUP('v')                                                    \
   KEYWORD("var", Token::JS_VAR)                                         \
   KEYWORD("void", Token::JS_VOID)                                       \
-  KEYWORD_GROUP('w')                                                    \
   KEYWORD("while", Token::JS_WHILE)                                     \
   KEYWORD("with", Token::JS_WITH)                                       \
-  KEYWORD_GROUP('y')                                                    \
   KEYWORD("yield", Token::JS_YIELD)
 
 
@@ -349,43 +201,219 @@ const char* TokenInfo::ToString() const {
 
 
 Token TokenInfo::GetIdentifierType(const char* maybe_keyword, bool es_harmony) {
-  const int input_length = Strlen(maybe_keyword);
-  const int min_length = 2;
-  const int max_length = 10;
-  if (input_length < min_length || input_length > max_length) {
-    return Token::JS_IDENTIFIER;
+  return GetIdentifierType(maybe_keyword, Strlen(maybe_keyword), es_harmony);
+}
+
+
+Token TokenInfo::GetIdentifierType(const char* maybe_keyword, size_t length, bool es_harmony) {
+  return es_harmony?
+      GetIdentifierType<true>(maybe_keyword, length):
+      GetIdentifierType<false>(maybe_keyword, length);
+}
+
+
+namespace {
+static const size_t kKeywordMinLength = 2;
+static const size_t kKeywordMaxLength = 10;
+#define KEYWORD_TABLE_SIZE 128
+
+
+struct Keyword {
+  const char* value;
+  size_t length;
+  Token token;
+};
+
+
+// The keyword is at least 2 characters, so the second character is always readable.
+// The coefficients are chosen to make the hash of the all keywords unique in the table.
+constexpr size_t KeywordHash(const char* keyword, size_t length) {
+  return (static_cast<size_t>(static_cast<uint8_t>(keyword[0])) * 8 +
+          static_cast<size_t>(static_cast<uint8_t>(keyword[length - 1])) * 28 +
+          static_cast<size_t>(static_cast<uint8_t>(keyword[1])) * 11 + length) &
+      (KEYWORD_TABLE_SIZE - 1);
+}
+
+
+/**
+ * The perfect hash table of the keywords.
+ * The table is built and checked at the compile time for each language mode.
+ */
+template <bool es_harmony>
+class KeywordTable : private Static {
+ public:
+#define KEYWORD_ENTRY(keyword, token) {keyword, sizeof(keyword) - 1, token},
+  static constexpr Keyword kKeywords[] = {
+    KEYWORDS(KEYWORD_ENTRY)
+  };
+#undef KEYWORD_ENTRY
+  
+  static constexpr size_t kSize = sizeof(kKeywords) / sizeof(Keyword);
+
+  
+  static constexpr size_t Hash(size_t index) {
+    return KeywordHash(kKeywords[index].value, kKeywords[index].length);
+  }
+
+
+  /**
+   * Find the keyword which hash is the slot.
+   * The empty slot is the keyword which length is 0, so it never matches.
+   */
+  static constexpr Keyword Slot(size_t slot, size_t index = 0) {
+    return index == kSize? Keyword{"", 0, Token::JS_IDENTIFIER}:
+        Hash(index) == slot? kKeywords[index]: Slot(slot, index + 1);
+  }
+
+
+  static constexpr bool IsUnique(size_t index, size_t other) {
+    return other == kSize? true:
+        Hash(index) != Hash(other) && IsUnique(index, other + 1);
+  }
+
+
+  static constexpr bool IsPerfect(size_t index = 0) {
+    return index == kSize? true:
+        kKeywords[index].length >= kKeywordMinLength &&
+        kKeywords[index].length <= kKeywordMaxLength &&
+        IsUnique(index, index + 1) && IsPerfect(index + 1);
   }
   
-  switch (maybe_keyword[0]) {
-    default:
-#define KEYWORD_GROUP_CASE(ch)                  \
-      break;                                    \
-    case ch:
-#define KEYWORD(keyword, token)                                         \
-      {                                                                 \
-        const int keyword_length = sizeof(keyword) - 1;                 \
-        static_assert(keyword_length >= min_length, "The length of the keyword must be greater than 2"); \
-        static_assert(keyword_length <= max_length, "The length of the keyword mst be less than 10"); \
-        if (input_length == keyword_length &&                           \
-            maybe_keyword[1] == keyword[1] &&                           \
-            (keyword_length <= 2 || maybe_keyword[2] == keyword[2]) &&  \
-            (keyword_length <= 3 || maybe_keyword[3] == keyword[3]) &&  \
-            (keyword_length <= 4 || maybe_keyword[4] == keyword[4]) &&  \
-            (keyword_length <= 5 || maybe_keyword[5] == keyword[5]) &&  \
-            (keyword_length <= 6 || maybe_keyword[6] == keyword[6]) &&  \
-            (keyword_length <= 7 || maybe_keyword[7] == keyword[7]) &&  \
-            (keyword_length <= 8 || maybe_keyword[8] == keyword[8]) &&  \
-            (keyword_length <= 9 || maybe_keyword[9] == keyword[9])) {  \
-          return token;                                                 \
-        }                                                               \
-      }
-      KEYWORDS(KEYWORD_GROUP_CASE, KEYWORD)
-          }
+  
+  static const Keyword kTable[KEYWORD_TABLE_SIZE];
+};
+
+
+template <bool es_harmony>
+constexpr Keyword KeywordTable<es_harmony>::kKeywords[];
+
+
+#define KEYWORD_SLOT(z, slot, _) KeywordTable<es_harmony>::Slot(slot)
+template <bool es_harmony>
+const Keyword KeywordTable<es_harmony>::kTable[KEYWORD_TABLE_SIZE] = {
+  BOOST_PP_ENUM(KEYWORD_TABLE_SIZE, KEYWORD_SLOT, _)
+};
+#undef KEYWORD_SLOT
+
+
+static_assert(KeywordTable<true>::IsPerfect(), "The keyword hash must be unique in the harmony keywords.");
+static_assert(KeywordTable<false>::IsPerfect(), "The keyword hash must be unique in the es3 keywords.");
+} // namespace
+
+
+template <bool es_harmony>
+Token TokenInfo::GetIdentifierType(const char* maybe_keyword, size_t length) {
+  if (length < kKeywordMinLength || length > kKeywordMaxLength) {
+    return Token::JS_IDENTIFIER;
+  }
+  const Keyword& keyword = KeywordTable<es_harmony>::kTable[KeywordHash(maybe_keyword, length)];
+  if (keyword.length == length && memcmp(keyword.value, maybe_keyword, length) == 0) {
+    return keyword.token;
+  }
   return Token::JS_IDENTIFIER;
 }
 
 
-Token TokenInfo::GetPunctureType(const UChar& uchar) {
-  return kPunctures[uchar.ToUC8Ascii()];
+template Token TokenInfo::GetIdentifierType<true>(const char* maybe_keyword, size_t length);
+template Token TokenInfo::GetIdentifierType<false>(const char* maybe_keyword, size_t length);
+
+#undef KEYWORD_TABLE_SIZE
+
+
+static int ToHexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  } else if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  } else if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+
+static UC16 ToHexEscape(const char* it, int len) {
+  UC16 result = 0;
+  for (int i = 0; i < len; i++) {
+    result = result * 16 + ToHexValue(it[i]);
+  }
+  return result;
+}
+
+
+// Append the one utf-8 character and return the next position.
+static const char* AppendChar(const char* it, UtfString* str) {
+  UnicodeIteratorAdapter<const char*> adapter(it);
+  (*str) += *adapter;
+  return it + utf8::GetByteCount(static_cast<UC8>(*it));
+}
+
+
+// The utf-8 can not hold the lone surrogate,
+// so the string is kept in the utf-16 after the first one.
+static void AppendLoneSurrogate(UC16 uc16, UtfString* str) {
+  if (str->encoding() != UtfString::Encoding::UTF16) {
+    UtfString utf16(UtfString::Encoding::UTF16);
+    utf16 += *str;
+    *str = std::move(utf16);
+  }
+  (*str) += UChar(unicode::u32(uc16));
+}
+
+
+UtfString TokenInfo::DecodeEscapeSequences(const char* it, const char* end) {
+  UtfString str;
+  while (it != end) {
+    if (*it != '\\') {
+      // Convert the characters until the next escape sequence at once.
+      const char* next = std::find(it, end, '\\');
+      str.Append(it, next);
+      it = next;
+      continue;
+    }
+
+    if (it[1] == 'u') {
+      UC16 uc16 = ToHexEscape(it + 2, 4);
+      it += 6;
+      if (!utf16::IsSurrogatePairUC16(uc16)) {
+        str += UChar(uc16);
+        continue;
+      }
+      // The escaped surrogate pair is the one code point.
+      if (utf16::IsHighSurrogateUC16(uc16) && end - it >= 6 && it[0] == '\\' && it[1] == 'u') {
+        UC16 low = ToHexEscape(it + 2, 4);
+        if (utf16::IsLowSurrogateUC16(low)) {
+          str += UChar(utf16::FromSurrogatePairUC16(uc16, low));
+          it += 6;
+          continue;
+        }
+      }
+      AppendLoneSurrogate(uc16, &str);
+    } else if (it[1] == 'x') {
+      UC8 uc8 = static_cast<UC8>(ToHexEscape(it + 2, 2));
+      str += UChar(unicode::u32(uc8));
+      it += 4;
+    } else {
+      // Keep the backslash and the escaped character.
+      it = AppendChar(it, &str);
+      if (it[0] == '\r' && it + 1 != end && it[1] == '\n') {
+        it = AppendChar(it, &str);
+      }
+      it = AppendChar(it, &str);
+    }
+  }
+  return str;
+}
+
+
+void TokenInfo::DecodeRawValue() const {
+  const char* raw_value = source_ + raw_offset_;
+  if (has_escapes_) {
+    vector_ = DecodeEscapeSequences(raw_value, raw_value + raw_length_);
+  } else {
+    vector_.Clear();
+    vector_.Append(raw_value, raw_value + raw_length_);
+  }
+  value_decoded_ = true;
 }
 }
@@ -26,6 +26,8 @@
 #define PARSER_TOKEN_H_
 
 #include <string>
+#include "./atom-table.h"
+#include "./line-index.h"
 #include "./utfstring.h"
 #include "./uchar.h"
 #include "../utils/utils.h"
@@ -152,9 +154,19 @@ class TokenInfo {
  public:
 
   TokenInfo() :
+      source_(nullptr),
+      raw_offset_(0),
+      raw_length_(0),
+      has_escapes_(false),
+      value_decoded_(false),
+      source_offset_(0),
+      source_length_(0),
+      numeric_value_(0),
+      atom_(AtomTable::kInvalidAtom),
       type_(Token::END_OF_INPUT),
       start_col_(0),
-      line_number_(1) {}
+      line_number_(1),
+      line_index_(nullptr) {}
   
 
   TokenInfo(const Token& token) = delete;
@@ -165,14 +177,106 @@ class TokenInfo {
 
   RASP_INLINE void set_value(UtfString&& vector) {
     vector_ = std::move(vector);
+    source_ = nullptr;
+  }
+
+
+  /**
+   * Set the value as the range of the utf-8 source buffer.
+   * The value is decoded when the value() is called at first,
+   * so the source buffer must be alive until then.
+   * @param source The front of the source buffer.
+   * @param raw_offset The byte offset of the value from the front of the source buffer.
+   * @param raw_length The byte length of the value.
+   * @param has_escapes Whether the value contains the escape sequence or not.
+   */
+  RASP_INLINE void set_raw_value(const char* source, size_t raw_offset, size_t raw_length, bool has_escapes) {
+    source_ = source;
+    raw_offset_ = raw_offset;
+    raw_length_ = raw_length;
+    has_escapes_ = has_escapes;
+    value_decoded_ = false;
   }
   
   
   RASP_INLINE const UtfString& value() const {
+    if (source_ != nullptr && !value_decoded_) {
+      DecodeRawValue();
+    }
     return vector_;
   }
 
 
+  /**
+   * The front of the value in the source buffer,
+   * or nullptr if the value is not the range of the source buffer.
+   */
+  RASP_INLINE const char* raw_value() const {
+    return source_ == nullptr? nullptr: source_ + raw_offset_;
+  }
+
+
+  RASP_INLINE size_t raw_offset() const {
+    return raw_offset_;
+  }
+
+
+  RASP_INLINE size_t raw_length() const {
+    return raw_length_;
+  }
+
+
+  RASP_INLINE bool has_escapes() const {
+    return has_escapes_;
+  }
+
+
+  /**
+   * Set the extent of the whole token, which is counted by the unit of the scanner input.
+   */
+  RASP_INLINE void set_source_range(size_t offset, size_t length) {
+    source_offset_ = offset;
+    source_length_ = length;
+  }
+
+
+  RASP_INLINE size_t source_offset() const {
+    return source_offset_;
+  }
+
+
+  RASP_INLINE size_t source_length() const {
+    return source_length_;
+  }
+
+
+  RASP_INLINE void set_numeric_value(double numeric_value) {
+    numeric_value_ = numeric_value;
+  }
+
+
+  /**
+   * The value of the numeric literal which is converted by the scanner.
+   */
+  RASP_INLINE double numeric_value() const {
+    return numeric_value_;
+  }
+
+
+  RASP_INLINE void set_atom(Atom atom) {
+    atom_ = atom;
+  }
+
+
+  /**
+   * The atom of the identifier in the AtomTable::Default(),
+   * or AtomTable::kInvalidAtom if the token is not the identifier.
+   */
+  RASP_INLINE Atom atom() const {
+    return atom_;
+  }
+
+
   RASP_INLINE void set_type(Token type) {
     type_ = type;
   }
@@ -189,7 +293,7 @@ class TokenInfo {
   
   
   RASP_INLINE size_t start_col() const {
-    return start_col_;
+    return line_index_ != nullptr? line_index_->Column(source_offset_): start_col_;
   }
 
 
@@ -199,7 +303,17 @@ class TokenInfo {
   
   
   RASP_INLINE size_t line_number() const {
-    return line_number_;
+    return line_index_ != nullptr? line_index_->LineNumber(source_offset_): line_number_;
+  }
+
+
+  /**
+   * Compute the line number and the column from the source offset by the line_index,
+   * instead of the values which are set by set_line_number and set_start_col.
+   * The line_index must be alive while the line number or the column is used.
+   */
+  RASP_INLINE void set_line_index(const LineIndex* line_index) {
+    line_index_ = line_index;
   }
 
 
@@ -210,13 +324,43 @@ class TokenInfo {
 
   static Token GetIdentifierType(const char* maybe_keyword, bool es_harmony = false);
 
-  static Token GetPunctureType(const UChar& uchar);
+
+  static Token GetIdentifierType(const char* maybe_keyword, size_t length, bool es_harmony = false);
+
+
+  /**
+   * Find the keyword by the perfect hash which is built at the compile time.
+   * The es3 and the harmony keyword tables are specialized by the es_harmony.
+   */
+  template <bool es_harmony>
+  static Token GetIdentifierType(const char* maybe_keyword, size_t length);
+
+
+  /**
+   * Decode the escape sequences of the identifier or the string literal body.
+   * The unicode and the hex escape sequences are decoded, and the other sequences are kept as is.
+   * @param begin The front of the value, which is already validated by the scanner.
+   * @param end The end of the value.
+   */
+  static UtfString DecodeEscapeSequences(const char* begin, const char* end);
   
  private:
-  UtfString vector_;
+  void DecodeRawValue() const;
+  
+  mutable UtfString vector_;
+  const char* source_;
+  size_t raw_offset_;
+  size_t raw_length_;
+  bool has_escapes_;
+  mutable bool value_decoded_;
+  size_t source_offset_;
+  size_t source_length_;
+  double numeric_value_;
+  Atom atom_;
   Token type_;
   size_t start_col_;
   size_t line_number_;
+  const LineIndex* line_index_;
 };
 }
 
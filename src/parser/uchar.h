@@ -27,6 +27,7 @@
 
 #include <string>
 #include <stdexcept>
+#include <type_traits>
 #include "../utils/utils.h"
 #include "../utils/os.h"
 #include "../utils/unicode.h"
@@ -35,23 +36,31 @@
 namespace rasp {
 /**
  * Utf-32 representation class.
+ * The UChar is only the 4 bytes code point which is passed by the register,
+ * and the utf-8 byte sequence is encoded from the code point on demand.
  */
 class UChar {
  public:
 
   RASP_INLINE static UChar Null() {
-    UC8Bytes b {{'\0'}};
-    return UChar(unicode::u32('\0'), b);
+    return UChar(unicode::u32('\0'));
+  }
+
+
+  /**
+   * The malformed utf-8 sequence of the unvalidated buffer.
+   * It is out of the unicode range, so it is not mistaken for the end of input.
+   */
+  RASP_INLINE static UChar Invalid() {
+    return UChar(unicode::kUnicodeMax + 1);
   }
   
   /**
    * Constructor
    * @param c utf-32 byte.
-   * @param utf8 utf-8 byte sequence.
    */
-  RASP_INLINE explicit UChar(UC32 c, const UC8Bytes& utf8):
-      uchar_(c),
-      utf8_(utf8){};
+  RASP_INLINE explicit UChar(UC32 c):
+      uchar_(c) {}
 
 
   /**
@@ -61,24 +70,13 @@ class UChar {
   RASP_INLINE UChar(): uchar_(0) {}
   
 
-  /**
-   * Copy constructor.
-   */
-  RASP_INLINE UChar(const UChar& uchar):
-      uchar_(uchar.uchar_), utf8_(uchar.utf8_) {}
+  UChar(const UChar& uchar) = default;
   
 
   ~UChar() = default;
 
 
-  /**
-   * Assignment
-   */
-  RASP_INLINE const UChar& operator = (const UChar& uchar) {
-    uchar_ = uchar.uchar_;
-    utf8_ = uchar.utf8_;
-    return *(this);
-  }
+  UChar& operator = (const UChar& uchar) = default;
   
 
   /**
@@ -88,14 +86,13 @@ class UChar {
   RASP_INLINE explicit operator UC16 () const {return uchar();}
   RASP_INLINE explicit operator UC8 () const {return ToUC8Ascii();}
   RASP_INLINE explicit operator int () const {return uchar();}
-  RASP_INLINE explicit operator const char* () const {return utf8();}
-  RASP_INLINE bool operator == (const UChar& uc) const {
+  RASP_INLINE bool operator == (UChar uc) const {
     return uc.uchar_ == uchar_;
   }
 
 
   RASP_INLINE bool operator == (const UC8 uc) const {
-    return uc == ToAscii();
+    return uc == uchar_;
   }
 
 
@@ -104,13 +101,13 @@ class UChar {
   }
 
 
-  RASP_INLINE bool operator != (const UChar& uc) const {
-    return uc.uchar_ == uchar_;
+  RASP_INLINE bool operator != (UChar uc) const {
+    return uc.uchar_ != uchar_;
   }
   
   
   RASP_INLINE bool operator != (const UC8 uc) const {
-    return uc != ToAscii();
+    return uc != uchar_;
   }
 
 
@@ -121,8 +118,7 @@ class UChar {
 
   inline const UChar operator + (const UC8 uc) const {
     char next = ToAscii() + static_cast<char>(uc);
-    UC8Bytes b{{next, '\0'}};
-    return UChar(next, b);
+    return UChar(unicode::u32(next));
   }
 
 
@@ -132,48 +128,47 @@ class UChar {
       throw std::out_of_range("Attempted to subtract by invalid ascii character.");
     }
     char next = ToAscii() - static_cast<char>(uc);
-    UC8Bytes b{{next, '\0'}};
-    return UChar(next, b);
+    return UChar(unicode::u32(next));
   }
   
 
-  RASP_INLINE bool operator > (const UChar& uchar) const {
+  RASP_INLINE bool operator > (UChar uchar) const {
     return uchar_ > uchar.uchar_;
   }
 
 
-  RASP_INLINE bool operator >= (const UChar& uchar) const {
+  RASP_INLINE bool operator >= (UChar uchar) const {
     return uchar_ >= uchar.uchar_;
   }
 
 
-  RASP_INLINE bool operator < (const UChar& uchar) const {
+  RASP_INLINE bool operator < (UChar uchar) const {
     return uchar_ < uchar.uchar_;
   }
 
 
-  RASP_INLINE bool operator <= (const UChar& uchar) const {
+  RASP_INLINE bool operator <= (UChar uchar) const {
     return uchar_ <= uchar.uchar_;
   }
   
 
   RASP_INLINE bool operator > (const UC8 uc) const {
-    return ToAscii() > uc;
+    return uchar_ > uc;
   }
 
 
   RASP_INLINE bool operator >= (const UC8 uc) const {
-    return ToAscii() >= uc;
+    return uchar_ >= uc;
   }
 
 
   RASP_INLINE bool operator < (const UC8 uc) const {
-    return ToAscii() < uc;
+    return uchar_ < uc;
   }
 
 
   RASP_INLINE bool operator <= (const UC8 uc) const {
-    return ToAscii() <= uc;
+    return uchar_ <= uc;
   }
 
 
@@ -209,6 +204,13 @@ class UChar {
    * @return ascii UC8 char.
    */
   RASP_INLINE UC8 ToUC8Ascii() const {return static_cast<UC8>(uchar_);}
+
+
+  /**
+   * Return the code point.
+   * @return utf-32 char.
+   */
+  RASP_INLINE UC32 ToUC32() const {return uchar_;}
   
 
   /**
@@ -243,7 +245,7 @@ class UChar {
    * @return true(if invalid) false(if valid)
    */
   RASP_INLINE bool IsInvalid() const {
-    return uchar_ == 0;
+    return uchar_ == 0 || uchar_ > unicode::kUnicodeMax;
   }
 
 
@@ -262,10 +264,24 @@ class UChar {
 
 
   /**
-   * Return utf-8 char array that represent this utf-16 byte sequence.
+   * Return the null terminated utf-8 byte sequence of the code point.
+   * The invalid char and the surrogate are the empty sequence.
    * @return utf-8 char array.
    */
-  RASP_INLINE const char* utf8() const {return utf8_.data();}
+  RASP_INLINE UC8Bytes ToUtf8() const {
+    UC8Bytes b;
+    b[WriteUtf8(b.data())] = '\0';
+    return b;
+  }
+
+
+  /**
+   * Write the utf-8 byte sequence of the code point to the out which has a room for 4 bytes.
+   * @return The byte count of the written sequence.
+   */
+  RASP_INLINE size_t WriteUtf8(char* out) const {
+    return IsInvalid()? 0: utf8::Encode(uchar_, out);
+  }
 
 
   RASP_INLINE size_t utf16_length() const {
@@ -274,14 +290,18 @@ class UChar {
 
 
   RASP_INLINE size_t utf8_length() const {
-    return utf8_.size() - 1;
+    char b[4];
+    return WriteUtf8(b);
   }
 
  private:
   
   UC32 uchar_;
-  UC8Bytes utf8_;
 };
+
+
+static_assert(sizeof(UChar) == 4, "UChar must be the 4 bytes code point.");
+static_assert(std::is_trivially_copyable<UChar>::value, "UChar must be passed by the register.");
 }
 
 
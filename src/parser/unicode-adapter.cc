@@ -48,7 +48,7 @@ UChar Unicode::Next() {
      *result++ = ToLowSurrogate(res);*/
     return UChar();
   } else if (next != 0) {
-    return UChar(static_cast<uint16_t>(next), piece_);
+    return UChar(static_cast<uint16_t>(next));
   }
   return UChar();
 }
@@ -63,12 +63,11 @@ UnicodeIteratorAdapter<InputIterator>::UnicodeIteratorAdapter(UnicodeIteratorAda
 
 template <typename InputIterator>
 UChar UnicodeIteratorAdapter<InputIterator>::Convert () const {
-  UC8Bytes utf8;
   auto byte_count = utf8::GetByteCount(*begin_);
-  auto next = ConvertUtf8ToUcs2(byte_count, &utf8);
+  auto next = ConvertUtf8ToUcs2(byte_count);
   // invalidate.
   if (next != 0) {
-    return UChar(next, utf8);
+    return UChar(next);
   }
   // invalid UChar.
   return UChar();
@@ -76,16 +75,16 @@ UChar UnicodeIteratorAdapter<InputIterator>::Convert () const {
 
 
 template <typename InputIterator>
-uint32_t UnicodeIteratorAdapter<InputIterator>::ConvertUtf8ToUcs2(size_t byte_count, UC8Bytes* utf8) const {
+uint32_t UnicodeIteratorAdapter<InputIterator>::ConvertUtf8ToUcs2(size_t byte_count) const {
   switch (byte_count) {
     case 1:
-      return ConvertAscii(utf8);
+      return ConvertAscii();
     case 2:
-      return Convert2Byte(utf8);
+      return Convert2Byte();
     case 3:
-      return Convert3Byte(utf8);
+      return Convert3Byte();
     case 4:
-      return Convert4Byte(utf8);
+      return Convert4Byte();
     default:
       return 0;
   }
@@ -93,18 +92,15 @@ uint32_t UnicodeIteratorAdapter<InputIterator>::ConvertUtf8ToUcs2(size_t byte_co
 
 
 template <typename InputIterator>
-uint32_t UnicodeIteratorAdapter<InputIterator>::Convert2Byte(UC8Bytes* utf8) const {
+uint32_t UnicodeIteratorAdapter<InputIterator>::Convert2Byte() const {
   const uint8_t kMinimumRange = 0x00000080;
   auto c = *begin_;
   if (utf8::IsNotNull(c)) {
-    (*utf8)[0] = c;
     auto next = unicode::Mask<5>(c) << 6;
     c = *(begin_ + 1);
     if (utf8::IsValidSequence(c)) {
       next = next | unicode::Mask<6>(c);
       if (next > kMinimumRange) {
-        (*utf8)[1] = c;
-        (*utf8)[2] = '\0';
         return next;
       }
     }
@@ -114,22 +110,18 @@ uint32_t UnicodeIteratorAdapter<InputIterator>::Convert2Byte(UC8Bytes* utf8) con
 
 
 template <typename InputIterator>
-uint32_t UnicodeIteratorAdapter<InputIterator>::Convert3Byte(UC8Bytes* utf8) const {
+uint32_t UnicodeIteratorAdapter<InputIterator>::Convert3Byte() const {
   const int kMinimumRange = 0x00000800;
   auto c = *begin_;
   if (utf8::IsNotNull(c)) {
-    (*utf8)[0] = c;
     auto next = unicode::Mask<4>(c) << 12;
     c = *(begin_ + 1);
     if (utf8::IsValidSequence(c)) {
-      (*utf8)[1] = c;
       next = next | unicode::Mask<6>(c) << 6;
       c = *(begin_ + 2);
       if (utf8::IsValidSequence(c)) {
         next = next | unicode::Mask<6>(c);
         if (next > kMinimumRange && utf16::IsOutOfSurrogateRange(next)) {
-          (*utf8)[2] = c;
-          (*utf8)[3] = '\0';
           return next;
         }
       }
@@ -140,26 +132,21 @@ uint32_t UnicodeIteratorAdapter<InputIterator>::Convert3Byte(UC8Bytes* utf8) con
 
 
 template <typename InputIterator>
-uint32_t UnicodeIteratorAdapter<InputIterator>::Convert4Byte(UC8Bytes* utf8) const {
+uint32_t UnicodeIteratorAdapter<InputIterator>::Convert4Byte() const {
   const int kMinimumRange = 0x000010000;
   auto c = *begin_;
   if (utf8::IsNotNull(c)) {
-    (*utf8)[0] = c;
     auto next = unicode::Mask<3>(c) << 18;
     c = *(begin_ + 1);
     if (utf8::IsValidSequence(c)) {
-      (*utf8)[1] = c;
       next = next | unicode::Mask<6>(c) << 12;
       c = *(begin_ + 2);
       if (utf8::IsValidSequence(c)) {
-        (*utf8)[2] = c;
         next = next | unicode::Mask<6>(c) << 6;
         c = *(begin_ + 3);
         if (utf8::IsValidSequence(c)) {
           next = next | unicode::Mask<6>(c);
           if (next >= kMinimumRange && next <= 0x10FFFF) {
-            (*utf8)[3] = c;
-            (*utf8)[4] = '\0';
             return next;
           }
         }
@@ -134,7 +134,7 @@ class UnicodeIteratorAdapter : public std::iterator<std::forward_iterator_tag, U
   /**
    * Convert current utf-8 byte sequence to ucs2 code set.
    */
-  UC32 ConvertUtf8ToUcs2(size_t byte_count, UC8Bytes* utf8) const;
+  UC32 ConvertUtf8ToUcs2(size_t byte_count) const;
 
 
   /**
@@ -155,39 +155,33 @@ class UnicodeIteratorAdapter : public std::iterator<std::forward_iterator_tag, U
   
   /**
    * Convert a utf-8 byte sequence.
-   * @param utf8 buffer to reserve utf-8 byte sequence.
    * @return utf-32 byte sequence.
    */
-  inline UC32 ConvertAscii(UC8Bytes* utf8) const {
+  inline UC32 ConvertAscii() const {
     UC8 uc = *begin_;
-    (*utf8)[0] = uc;
-    (*utf8)[1] = '\0';
     return unicode::Mask<8>(uc);
   }
   
 
   /**
    * Convert 2 utf-8 byte sequence.
-   * @param utf8 buffer to reserve utf-8 byte sequence.
    * @return utf-32 byte sequence.
    */
-  UC32 Convert2Byte(UC8Bytes* utf8) const;
+  UC32 Convert2Byte() const;
 
 
   /**
    * Convert 3 utf-8 byte sequence.
-   * @param utf8 buffer to reserve utf-8 byte sequence.
    * @return utf-32 byte sequence.
    */
-  UC32 Convert3Byte(UC8Bytes* utf8) const;
+  UC32 Convert3Byte() const;
 
 
   /**
    * Convert 4 utf-8 byte sequence.
-   * @param utf8 buffer to reserve utf-8 byte sequence.
    * @return utf-32 byte sequence.
    */
-  UC32 Convert4Byte(UC8Bytes* utf8) const;
+  UC32 Convert4Byte() const;
 
   
   UC32 current_position_;
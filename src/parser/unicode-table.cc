@@ -0,0 +1,541 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// This file is generated by tools/gen-unicode-table.py, do not edit.
+// Unicode 14.0.0
+
+#include "unicode-table.h"
+
+namespace rasp {
+
+static_assert(UnicodeTable::kPageBits == 8, "Regenerate unicode-table.cc.");
+static_assert(UnicodeTable::kBlockCount == 191, "Regenerate unicode-table.cc.");
+static_assert(UnicodeTable::kIdentifierStartPageCount == 788, "Regenerate unicode-table.cc.");
+static_assert(UnicodeTable::kIdentifierPartPageCount == 3586, "Regenerate unicode-table.cc.");
+static_assert(UnicodeTable::kWhiteSpacePageCount == 255, "Regenerate unicode-table.cc.");
+
+const uint8_t UnicodeTable::kPageBits;
+const size_t UnicodeTable::kBlockCount;
+const size_t UnicodeTable::kIdentifierStartPageCount;
+const size_t UnicodeTable::kIdentifierPartPageCount;
+const size_t UnicodeTable::kWhiteSpacePageCount;
+
+
+const uint8_t UnicodeTable::kIdentifierStartPages[] = {
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, // U+0000
+  17, 2, 18, 19, 20, 2, 21, 22, 23, 24, 25, 26, 27, 28, 2, 29, // U+1000
+  30, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 33, 0, 0, // U+2000
+  34, 35, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+3000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 28, 2, 2, // U+4000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+5000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+6000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+7000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+8000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+9000
+  2, 2, 2, 2, 36, 2, 37, 38, 39, 40, 41, 42, 2, 2, 2, 2, // U+A000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+B000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+C000
+  2, 2, 2, 2, 2, 2, 2, 43, 0, 0, 0, 0, 0, 0, 0, 0, // U+D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 44, 45, 2, 46, 47, 48, // U+F000
+  49, 50, 51, 52, 53, 54, 2, 55, 56, 57, 58, 59, 60, 61, 62, 63, // U+10000
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 0, 75, 76, 77, 78, // U+11000
+  2, 2, 2, 79, 80, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, // U+12000
+  2, 2, 2, 2, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+13000
+  0, 0, 0, 0, 2, 2, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+14000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+15000
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 85, 86, 0, 0, 87, 88, // U+16000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+17000
+  2, 2, 2, 2, 2, 2, 2, 89, 2, 2, 2, 2, 90, 91, 0, 0, // U+18000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+19000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, // U+1A000
+  2, 93, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 0, 0, // U+1B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+1C000
+  0, 0, 0, 0, 96, 97, 98, 99, 0, 0, 0, 0, 0, 0, 0, 100, // U+1D000
+  0, 101, 102, 0, 0, 0, 0, 103, 104, 105, 0, 0, 0, 0, 106, 0, // U+1E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+1F000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+20000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+21000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+22000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+23000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+24000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+25000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+26000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+27000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+28000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+29000
+  2, 2, 2, 2, 2, 2, 107, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+2A000
+  2, 2, 2, 2, 2, 2, 2, 108, 109, 2, 2, 2, 2, 2, 2, 2, // U+2B000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 110, 2, // U+2C000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+2D000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 0, 0, 0, 0, // U+2E000
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 112, 0, 0, 0, 0, 0, // U+2F000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+30000
+  2, 2, 2, 113, // U+31000
+};
+
+
+const uint8_t UnicodeTable::kIdentifierPartPages[] = {
+  114, 2, 3, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, // U+0000
+  128, 2, 18, 129, 20, 2, 21, 130, 131, 132, 133, 134, 135, 2, 2, 29, // U+1000
+  136, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 138, 0, 0, // U+2000
+  139, 35, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+3000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 28, 2, 2, // U+4000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+5000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+6000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+7000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+8000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+9000
+  2, 2, 2, 2, 36, 2, 140, 38, 141, 142, 143, 144, 2, 2, 2, 2, // U+A000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+B000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+C000
+  2, 2, 2, 2, 2, 2, 2, 43, 0, 0, 0, 0, 0, 0, 0, 0, // U+D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 44, 145, 2, 46, 146, 147, // U+F000
+  49, 148, 149, 150, 151, 54, 2, 55, 56, 57, 152, 59, 60, 153, 154, 155, // U+10000
+  156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 0, 167, 168, 169, 78, // U+11000
+  2, 2, 2, 79, 80, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, // U+12000
+  2, 2, 2, 2, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+13000
+  0, 0, 0, 0, 2, 2, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+14000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+15000
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 170, 171, 0, 0, 87, 172, // U+16000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+17000
+  2, 2, 2, 2, 2, 2, 2, 89, 2, 2, 2, 2, 90, 91, 0, 0, // U+18000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+19000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, // U+1A000
+  2, 93, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 173, 0, 0, 0, // U+1B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 174, // U+1C000
+  0, 175, 176, 0, 96, 97, 98, 177, 0, 0, 178, 0, 0, 0, 0, 100, // U+1D000
+  179, 180, 181, 0, 0, 0, 0, 103, 182, 183, 0, 0, 0, 0, 106, 0, // U+1E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 0, 0, 0, 0, // U+1F000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+20000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+21000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+22000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+23000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+24000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+25000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+26000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+27000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+28000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+29000
+  2, 2, 2, 2, 2, 2, 107, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+2A000
+  2, 2, 2, 2, 2, 2, 2, 108, 109, 2, 2, 2, 2, 2, 2, 2, // U+2B000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 110, 2, // U+2C000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+2D000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 0, 0, 0, 0, // U+2E000
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 112, 0, 0, 0, 0, 0, // U+2F000
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // U+30000
+  2, 2, 2, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+31000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+32000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+33000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+34000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+35000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+36000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+37000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+38000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+39000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+3A000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+3B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+3C000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+3D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+3E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+3F000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+40000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+41000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+42000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+43000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+44000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+45000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+46000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+47000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+48000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+49000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+4A000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+4B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+4C000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+4D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+4E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+4F000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+50000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+51000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+52000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+53000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+54000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+55000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+56000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+57000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+58000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+59000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+5A000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+5B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+5C000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+5D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+5E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+5F000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+60000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+61000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+62000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+63000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+64000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+65000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+66000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+67000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+68000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+69000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+6A000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+6B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+6C000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+6D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+6E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+6F000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+70000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+71000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+72000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+73000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+74000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+75000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+76000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+77000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+78000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+79000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+7A000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+7B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+7C000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+7D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+7E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+7F000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+80000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+81000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+82000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+83000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+84000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+85000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+86000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+87000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+88000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+89000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+8A000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+8B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+8C000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+8D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+8E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+8F000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+90000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+91000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+92000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+93000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+94000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+95000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+96000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+97000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+98000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+99000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+9A000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+9B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+9C000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+9D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+9E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+9F000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A0000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A1000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A2000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A3000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A4000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A5000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A6000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A7000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A8000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A9000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+AA000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+AB000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+AC000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+AD000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+AE000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+AF000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B0000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B1000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B2000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B3000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B4000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B5000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B6000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B7000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B8000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B9000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+BA000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+BB000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+BC000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+BD000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+BE000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+BF000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C0000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C1000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C2000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C3000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C4000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C5000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C6000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C7000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C8000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C9000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+CA000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+CB000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+CC000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+CD000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+CE000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+CF000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D0000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D1000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D2000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D3000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D4000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D5000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D6000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D7000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D8000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D9000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+DA000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+DB000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+DC000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+DD000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+DE000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+DF000
+  0, 185, // U+E0000
+};
+
+
+const uint8_t UnicodeTable::kWhiteSpacePages[] = {
+  186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+  0, 0, 0, 0, 0, 0, 187, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+1000
+  188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+2000
+  189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+3000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+4000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+5000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+6000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+7000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+8000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+9000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+A000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+B000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+C000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+D000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+E000
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 190, // U+F000
+};
+
+
+const uint32_t UnicodeTable::kBlocks[][UnicodeTable::kBlockWords] = {
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 0
+  {0x00000000, 0x00000010, 0x87fffffe, 0x07fffffe, 0x00000000, 0x04200400, 0xff7fffff, 0xff7fffff}, // 1
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, // 2
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0003ffc3, 0x0000501f}, // 3
+  {0x00000000, 0x00000000, 0x00000000, 0xbcdf0000, 0xffffd740, 0xfffffffb, 0xffffffff, 0xffbfffff}, // 4
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffc03, 0xffffffff, 0xffffffff, 0xffffffff}, // 5
+  {0xffffffff, 0xfffeffff, 0x027fffff, 0xffffffff, 0x000001ff, 0x00000000, 0xffff0000, 0x000787ff}, // 6
+  {0x00000000, 0xffffffff, 0x000007ff, 0xfffec000, 0xffffffff, 0xffffffff, 0x002fffff, 0x9c00c060}, // 7
+  {0xfffd0000, 0x0000ffff, 0xffffe000, 0xffffffff, 0xffffffff, 0x0002003f, 0xfffffc00, 0x043007ff}, // 8
+  {0x043fffff, 0x00000110, 0x01ffffff, 0xffff07ff, 0x00007eff, 0xffffffff, 0x000003ff, 0x00000000}, // 9
+  {0xfffffff0, 0x23ffffff, 0xff010000, 0xfffe0003, 0xfff99fe1, 0x23c5fdff, 0xb0004000, 0x10030003}, // 10
+  {0xfff987e0, 0x036dfdff, 0x5e000000, 0x001c0000, 0xfffbbfe0, 0x23edfdff, 0x00010000, 0x02000003}, // 11
+  {0xfff99fe0, 0x23edfdff, 0xb0000000, 0x00020003, 0xd63dc7e8, 0x03ffc718, 0x00010000, 0x00000000}, // 12
+  {0xfffddfe0, 0x23fffdff, 0x27000000, 0x00000003, 0xfffddfe1, 0x23effdff, 0x60000000, 0x00060003}, // 13
+  {0xfffddff0, 0x27ffffff, 0x80704000, 0xfc000003, 0xfc7fffe0, 0x2ffbffff, 0x0000007f, 0x00000000}, // 14
+  {0xfffffffe, 0x000dffff, 0x0000007f, 0x00000000, 0xfffff7d6, 0x200dffaf, 0xf000005f, 0x00000000}, // 15
+  {0x00000001, 0x00000000, 0xfffffeff, 0x00001fff, 0x00001f00, 0x00000000, 0x00000000, 0x00000000}, // 16
+  {0xffffffff, 0x800007ff, 0x3c3f0000, 0xffe1c062, 0x00004003, 0xffffffff, 0xffff20bf, 0xf7ffffff}, // 17
+  {0xffffffff, 0xffffffff, 0x3d7f3dff, 0xffffffff, 0xffff3dff, 0x7f3dffff, 0xff7fff3d, 0xffffffff}, // 18
+  {0xff3dffff, 0xffffffff, 0x07ffffff, 0x00000000, 0x0000ffff, 0xffffffff, 0xffffffff, 0x3f3fffff}, // 19
+  {0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, // 20
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffff9fff, 0x07fffffe, 0xffffffff, 0xffffffff, 0x01ffc7ff}, // 21
+  {0x8003ffff, 0x0003ffff, 0x0003ffff, 0x0001dfff, 0xffffffff, 0x000fffff, 0x10800000, 0x00000000}, // 22
+  {0x00000000, 0xffffffff, 0xffffffff, 0x01ffffff, 0xffffffff, 0xffff05ff, 0xffffffff, 0x003fffff}, // 23
+  {0x7fffffff, 0x00000000, 0xffff0000, 0x001f3fff, 0xffffffff, 0xffff0fff, 0x000003ff, 0x00000000}, // 24
+  {0x007fffff, 0xffffffff, 0x001fffff, 0x00000000, 0x00000000, 0x00000080, 0x00000000, 0x00000000}, // 25
+  {0xffffffe0, 0x000fffff, 0x00001fe0, 0x00000000, 0xfffffff8, 0xfc00c001, 0xffffffff, 0x0000003f}, // 26
+  {0xffffffff, 0x0000000f, 0xfc00e000, 0x3fffffff, 0xffff01ff, 0xe7ffffff, 0x00000000, 0x046fde00}, // 27
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000}, // 28
+  {0x3f3fffff, 0xffffffff, 0xaaff3f3f, 0x3fffffff, 0xffffffff, 0x5fdfffff, 0x0fcf1fdc, 0x1fdc1fff}, // 29
+  {0x00000000, 0x00000000, 0x00000000, 0x80020000, 0x1fff0000, 0x00000000, 0x00000000, 0x00000000}, // 30
+  {0x3f2ffc84, 0xf3fffd50, 0x000043e0, 0xffffffff, 0x000001ff, 0x00000000, 0x00000000, 0x00000000}, // 31
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000c781f}, // 32
+  {0xffffffff, 0xffff20bf, 0xffffffff, 0x000080ff, 0x007fffff, 0x7f7f7f7f, 0x7f7f7f7f, 0x00000000}, // 33
+  {0x000000e0, 0x1f3e03fe, 0xfffffffe, 0xffffffff, 0xf87fffff, 0xfffffffe, 0xffffffff, 0xf7ffffff}, // 34
+  {0xffffffe0, 0xfffeffff, 0xffffffff, 0xffffffff, 0x00007fff, 0xffffffff, 0x00000000, 0xffff0000}, // 35
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00001fff, 0x00000000, 0xffff0000, 0x3fffffff}, // 36
+  {0xffff1fff, 0x00000c00, 0xffffffff, 0x80007fff, 0x3fffffff, 0xffffffff, 0xffffffff, 0x0000ffff}, // 37
+  {0xff800000, 0xfffffffc, 0xffffffff, 0xffffffff, 0xfffff9ff, 0xffffffff, 0x03eb07ff, 0xfffc0000}, // 38
+  {0xfffff7bb, 0x00000007, 0xffffffff, 0x000fffff, 0xfffffffc, 0x000fffff, 0x00000000, 0x68fc0000}, // 39
+  {0xfffffc00, 0xffff003f, 0x0000007f, 0x1fffffff, 0xfffffff0, 0x0007ffff, 0x00008000, 0x7c00ffdf}, // 40
+  {0xffffffff, 0x000001ff, 0x00000ff7, 0xc47fffff, 0xffffffff, 0x3e62ffff, 0x38000005, 0x001c07ff}, // 41
+  {0x007e7e7e, 0xffff7f7f, 0xf7ffffff, 0xffff03ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007}, // 42
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff000f, 0xfffff87f, 0x0fffffff}, // 43
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffff3fff, 0xffffffff, 0xffffffff, 0x03ffffff, 0x00000000}, // 44
+  {0xa0f8007f, 0x5f7ffdff, 0xffffffdb, 0xffffffff, 0xffffffff, 0x0003ffff, 0xfff80000, 0xffffffff}, // 45
+  {0xffffffff, 0x3fffffff, 0xffff0000, 0xffffffff, 0xfffcffff, 0xffffffff, 0x000000ff, 0x0fff0000}, // 46
+  {0x00000000, 0x00000000, 0x00000000, 0xffdf0000, 0xffffffff, 0xffffffff, 0xffffffff, 0x1fffffff}, // 47
+  {0x00000000, 0x07fffffe, 0x07fffffe, 0xffffffc0, 0xffffffff, 0x7fffffff, 0x1cfcfcfc, 0x00000000}, // 48
+  {0xffffefff, 0xb7ffff7f, 0x3fff3fff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0x07ffffff}, // 49
+  {0x00000000, 0x00000000, 0xffffffff, 0x001fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 50
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fffffff, 0xffffffff, 0x0001ffff, 0x00000000}, // 51
+  {0xffffffff, 0xffffe000, 0xffff07ff, 0x003fffff, 0x3fffffff, 0xffffffff, 0x003eff0f, 0x00000000}, // 52
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, 0xffff0000, 0xff0fffff, 0x0fffffff}, // 53
+  {0xffffffff, 0xffff00ff, 0xffffffff, 0xf7ff000f, 0xffb7f7ff, 0x1bfbfffb, 0x00000000, 0x00000000}, // 54
+  {0xffffffff, 0x007fffff, 0x003fffff, 0x000000ff, 0xffffffbf, 0x07fdffff, 0x00000000, 0x00000000}, // 55
+  {0xfffffd3f, 0x91bfffff, 0x003fffff, 0x007fffff, 0x7fffffff, 0x00000000, 0x00000000, 0x0037ffff}, // 56
+  {0x003fffff, 0x03ffffff, 0x00000000, 0x00000000, 0xffffffff, 0xc0ffffff, 0x00000000, 0x00000000}, // 57
+  {0xfeef0001, 0x003fffff, 0x00000000, 0x1fffffff, 0x1fffffff, 0x00000000, 0xfffffeff, 0x0000001f}, // 58
+  {0xffffffff, 0x003fffff, 0x003fffff, 0x0007ffff, 0x0003ffff, 0x00000000, 0x00000000, 0x00000000}, // 59
+  {0xffffffff, 0xffffffff, 0x000001ff, 0x00000000, 0xffffffff, 0x0007ffff, 0xffffffff, 0x0007ffff}, // 60
+  {0xffffffff, 0x0000000f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 61
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x000303ff, 0x00000000, 0x00000000}, // 62
+  {0x1fffffff, 0xffff0080, 0x0000003f, 0xffff0000, 0x00000003, 0xffff0000, 0x0000001f, 0x007fffff}, // 63
+  {0xfffffff8, 0x00ffffff, 0x00000000, 0x00260000, 0xfffffff8, 0x0000ffff, 0xffff0000, 0x000001ff}, // 64
+  {0xfffffff8, 0x0000007f, 0xffff0090, 0x0047ffff, 0xfffffff8, 0x0007ffff, 0x1400001e, 0x00000000}, // 65
+  {0xfffbffff, 0x00000fff, 0x00000000, 0x00000000, 0xbfffbd7f, 0xffff01ff, 0x7fffffff, 0x00000000}, // 66
+  {0xfff99fe0, 0x23edfdff, 0xe0010000, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 67
+  {0xffffffff, 0x001fffff, 0x80000780, 0x00000003, 0xffffffff, 0x0000ffff, 0x000000b0, 0x00000000}, // 68
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00007fff, 0x0f000000, 0x00000000}, // 69
+  {0xffffffff, 0x0000ffff, 0x00000010, 0x00000000, 0xffffffff, 0x010007ff, 0x00000000, 0x00000000}, // 70
+  {0x07ffffff, 0x00000000, 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 71
+  {0xffffffff, 0x00000fff, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0x80000000}, // 72
+  {0xff6ff27f, 0x8000ffff, 0x00000002, 0x00000000, 0x00000000, 0xfffffcff, 0x0001ffff, 0x0000000a}, // 73
+  {0xfffff801, 0x0407ffff, 0xf0010000, 0xffffffff, 0x200003ff, 0xffff0000, 0xffffffff, 0x01ffffff}, // 74
+  {0xfffffdff, 0x00007fff, 0x00000001, 0xfffc0000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000}, // 75
+  {0xfffffb7f, 0x0001ffff, 0x00000040, 0xfffffdbf, 0x010003ff, 0x00000000, 0x00000000, 0x00000000}, // 76
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0007ffff}, // 77
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000}, // 78
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x03ffffff, 0x00000000, 0x00000000, 0x00000000}, // 79
+  {0xffffffff, 0xffffffff, 0xffffffff, 0x00007fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, // 80
+  {0xffffffff, 0xffffffff, 0x0000000f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 81
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0xffffffff, 0xffffffff, 0x0001ffff}, // 82
+  {0xffffffff, 0x00007fff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 83
+  {0xffffffff, 0xffffffff, 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 84
+  {0xffffffff, 0x01ffffff, 0x7fffffff, 0xffff0000, 0xffffffff, 0x7fffffff, 0xffff0000, 0x00003fff}, // 85
+  {0xffffffff, 0x0000ffff, 0x0000000f, 0xe0fffff8, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000}, // 86
+  {0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 87
+  {0xffffffff, 0xffffffff, 0x000107ff, 0x00000000, 0xfff80000, 0x00000000, 0x00000000, 0x0000000b}, // 88
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffffff}, // 89
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x003fffff, 0x00000000}, // 90
+  {0x000001ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 91
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6fef0000}, // 92
+  {0xffffffff, 0x00000007, 0x00070000, 0xffff00f0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, // 93
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0fffffff}, // 94
+  {0xffffffff, 0xffffffff, 0xffffffff, 0x1fff07ff, 0x03ff01ff, 0x00000000, 0x00000000, 0x00000000}, // 95
+  {0xffffffff, 0xffffffff, 0xffdfffff, 0xffffffff, 0xdfffffff, 0xebffde64, 0xffffffef, 0xffffffff}, // 96
+  {0xdfdfe7bf, 0x7bffffff, 0xfffdfc5f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, // 97
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff3f, 0xf7fffffd, 0xf7ffffff}, // 98
+  {0xffdfffff, 0xffdfffff, 0xffff7fff, 0xffff7fff, 0xfffffdff, 0xfffffdff, 0x00000ff7, 0x00000000}, // 99
+  {0x7fffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 100
+  {0xffffffff, 0x3f801fff, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 101
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0x00003fff, 0xffffffff, 0x00000fff}, // 102
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7fff6f7f}, // 103
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0000001f, 0x00000000}, // 104
+  {0xffffffff, 0xffffffff, 0x0000080f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 105
+  {0xffffffef, 0x0af7fe96, 0xaa96ea84, 0x5ef7f796, 0x0ffffbff, 0x0ffffbee, 0x00000000, 0x00000000}, // 106
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000}, // 107
+  {0xffffffff, 0x01ffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, // 108
+  {0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, // 109
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff0003, 0xffffffff, 0xffffffff}, // 110
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001}, // 111
+  {0x3fffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 112
+  {0xffffffff, 0xffffffff, 0x000007ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 113
+  {0x00000000, 0x03ff0010, 0x87fffffe, 0x07fffffe, 0x00000000, 0x04a00400, 0xff7fffff, 0xff7fffff}, // 114
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xbcdfffff, 0xffffd7c0, 0xfffffffb, 0xffffffff, 0xffbfffff}, // 115
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffcfb, 0xffffffff, 0xffffffff, 0xffffffff}, // 116
+  {0xffffffff, 0xfffeffff, 0x027fffff, 0xffffffff, 0xfffe01ff, 0xbfffffff, 0xffff00b6, 0x000787ff}, // 117
+  {0x07ff0000, 0xffffffff, 0xffffffff, 0xffffc3ff, 0xffffffff, 0xffffffff, 0x9fefffff, 0x9ffffdff}, // 118
+  {0xffff0000, 0xffffffff, 0xffffe7ff, 0xffffffff, 0xffffffff, 0x0003ffff, 0xffffffff, 0x243fffff}, // 119
+  {0xffffffff, 0x00003fff, 0x0fffffff, 0xffff07ff, 0xff007eff, 0xffffffff, 0xffffffff, 0xfffffffb}, // 120
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xfffeffcf, 0xfff99fef, 0xf3c5fdff, 0xb080799f, 0x5003ffcf}, // 121
+  {0xfff987ee, 0xd36dfdff, 0x5e023987, 0x003fffc0, 0xfffbbfee, 0xf3edfdff, 0x00013bbf, 0xfe00ffcf}, // 122
+  {0xfff99fee, 0xf3edfdff, 0xb0e0399f, 0x0002ffcf, 0xd63dc7ec, 0xc3ffc718, 0x00813dc7, 0x0000ffc0}, // 123
+  {0xfffddfff, 0xf3fffdff, 0x27603ddf, 0x0000ffcf, 0xfffddfef, 0xf3effdff, 0x60603ddf, 0x0006ffcf}, // 124
+  {0xfffddfff, 0xffffffff, 0x80f07ddf, 0xfc00ffcf, 0xfc7fffee, 0x2ffbffff, 0xff5f847f, 0x000cffc0}, // 125
+  {0xfffffffe, 0x07ffffff, 0x03ff7fff, 0x00000000, 0xfffff7d6, 0x3fffffaf, 0xf3ff3f5f, 0x00000000}, // 126
+  {0x03000001, 0xc2a003ff, 0xfffffeff, 0xfffe1fff, 0xfeffffdf, 0x1fffffff, 0x00000040, 0x00000000}, // 127
+  {0xffffffff, 0xffffffff, 0xffff03ff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffff20bf, 0xf7ffffff}, // 128
+  {0xff3dffff, 0xffffffff, 0xe7ffffff, 0x0003fe00, 0x0000ffff, 0xffffffff, 0xffffffff, 0x3f3fffff}, // 129
+  {0x803fffff, 0x001fffff, 0x000fffff, 0x000ddfff, 0xffffffff, 0xffffffff, 0x308fffff, 0x000003ff}, // 130
+  {0x03ffb800, 0xffffffff, 0xffffffff, 0x01ffffff, 0xffffffff, 0xffff07ff, 0xffffffff, 0x003fffff}, // 131
+  {0x7fffffff, 0x0fff0fff, 0xffffffc0, 0x001f3fff, 0xffffffff, 0xffff0fff, 0x07ff03ff, 0x00000000}, // 132
+  {0x0fffffff, 0xffffffff, 0x7fffffff, 0x9fffffff, 0x03ff03ff, 0xbfff0080, 0x00007fff, 0x00000000}, // 133
+  {0xffffffff, 0xffffffff, 0x03ff1fff, 0x000ff800, 0xffffffff, 0xffffffff, 0xffffffff, 0x000fffff}, // 134
+  {0xffffffff, 0x00ffffff, 0xffffe3ff, 0x3fffffff, 0xffff01ff, 0xe7ffffff, 0xfff70000, 0x07ffffff}, // 135
+  {0x00003000, 0x80000000, 0x00100001, 0x80020000, 0x1fff0000, 0x00000000, 0x1fff0000, 0x0001ffe2}, // 136
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000ff81f}, // 137
+  {0xffffffff, 0xffff20bf, 0xffffffff, 0x800080ff, 0x007fffff, 0x7f7f7f7f, 0x7f7f7f7f, 0xffffffff}, // 138
+  {0x000000e0, 0x1f3efffe, 0xfffffffe, 0xffffffff, 0xfe7fffff, 0xfffffffe, 0xffffffff, 0xf7ffffff}, // 139
+  {0xffff1fff, 0x00000fff, 0xffffffff, 0xbff0ffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0003ffff}, // 140
+  {0xffffffff, 0x000010ff, 0xffffffff, 0x000fffff, 0xffffffff, 0xffffffff, 0x03ff003f, 0xe8ffffff}, // 141
+  {0xffffffff, 0xffff3fff, 0x000fffff, 0x1fffffff, 0xffffffff, 0xffffffff, 0x03ff8001, 0x7fffffff}, // 142
+  {0xffffffff, 0x007fffff, 0x03ff3fff, 0xfc7fffff, 0xffffffff, 0xffffffff, 0x38000007, 0x007cffff}, // 143
+  {0x007e7e7e, 0xffff7f7f, 0xf7ffffff, 0xffff03ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x03ff37ff}, // 144
+  {0xe0f8007f, 0x5f7ffdff, 0xffffffdb, 0xffffffff, 0xffffffff, 0x0003ffff, 0xfff80000, 0xffffffff}, // 145
+  {0x0000ffff, 0x0018ffff, 0x0000e000, 0xffdf0000, 0xffffffff, 0xffffffff, 0xffffffff, 0x1fffffff}, // 146
+  {0x03ff0000, 0x87fffffe, 0x07fffffe, 0xffffffc0, 0xffffffff, 0x7fffffff, 0x1cfcfcfc, 0x00000000}, // 147
+  {0x00000000, 0x00000000, 0xffffffff, 0x001fffff, 0x00000000, 0x00000000, 0x00000000, 0x20000000}, // 148
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fffffff, 0xffffffff, 0x0001ffff, 0x00000001}, // 149
+  {0xffffffff, 0xffffe000, 0xffff07ff, 0x07ffffff, 0x3fffffff, 0xffffffff, 0x003eff0f, 0x00000000}, // 150
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, 0xffff03ff, 0xff0fffff, 0x0fffffff}, // 151
+  {0xfeeff06f, 0x873fffff, 0x00000000, 0x1fffffff, 0x1fffffff, 0x00000000, 0xfffffeff, 0x0000007f}, // 152
+  {0xffffffff, 0x03ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 153
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00031bff, 0x00000000, 0x00000000}, // 154
+  {0x1fffffff, 0xffff0080, 0x0001ffff, 0xffff0000, 0x0000003f, 0xffff0000, 0x0000001f, 0x007fffff}, // 155
+  {0xffffffff, 0xffffffff, 0x0000007f, 0x803fffc0, 0xffffffff, 0x07ffffff, 0xffff0004, 0x03ff01ff}, // 156
+  {0xffffffff, 0xffdfffff, 0xffff00f0, 0x004fffff, 0xffffffff, 0xffffffff, 0x17ffde1f, 0x00000000}, // 157
+  {0xfffbffff, 0x40ffffff, 0x00000000, 0x00000000, 0xbfffbd7f, 0xffff01ff, 0xffffffff, 0x03ff07ff}, // 158
+  {0xfff99fef, 0xfbedfdff, 0xe081399f, 0x001f1fcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 159
+  {0xffffffff, 0xffffffff, 0xc3ff07ff, 0x00000003, 0xffffffff, 0xffffffff, 0x03ff00bf, 0x00000000}, // 160
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xff3fffff, 0x3f000001, 0x00000000}, // 161
+  {0xffffffff, 0xffffffff, 0x03ff0011, 0x00000000, 0xffffffff, 0x01ffffff, 0x000003ff, 0x00000000}, // 162
+  {0xe7ffffff, 0x03ff0fff, 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 163
+  {0xffffffff, 0x07ffffff, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0x800003ff}, // 164
+  {0xff6ff27f, 0xf9bfffff, 0x03ff000f, 0x00000000, 0x00000000, 0xfffffcff, 0xfcffffff, 0x0000001b}, // 165
+  {0xffffffff, 0x7fffffff, 0xffff0080, 0xffffffff, 0x23ffffff, 0xffff0000, 0xffffffff, 0x01ffffff}, // 166
+  {0xfffffdff, 0xff7fffff, 0x03ff0001, 0xfffc0000, 0xfffcffff, 0x007ffeff, 0x00000000, 0x00000000}, // 167
+  {0xfffffb7f, 0xb47fffff, 0x03ff00ff, 0xfffffdbf, 0x01fb7fff, 0x000003ff, 0x00000000, 0x00000000}, // 168
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007fffff}, // 169
+  {0xffffffff, 0x01ffffff, 0x7fffffff, 0xffff03ff, 0xffffffff, 0x7fffffff, 0xffff03ff, 0x001f3fff}, // 170
+  {0xffffffff, 0x007fffff, 0x03ff000f, 0xe0fffff8, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000}, // 171
+  {0xffffffff, 0xffffffff, 0xffff87ff, 0xffffffff, 0xffff80ff, 0x00000000, 0x00000000, 0x0003001b}, // 172
+  {0xffffffff, 0xffffffff, 0xffffffff, 0x1fff07ff, 0x63ff01ff, 0x00000000, 0x00000000, 0x00000000}, // 173
+  {0xffffffff, 0xffff3fff, 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 174
+  {0x00000000, 0x00000000, 0x00000000, 0xf807e3e0, 0x00000fe7, 0x00003c00, 0x00000000, 0x00000000}, // 175
+  {0x00000000, 0x00000000, 0x0000001c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 176
+  {0xffdfffff, 0xffdfffff, 0xffff7fff, 0xffff7fff, 0xfffffdff, 0xfffffdff, 0xffffcff7, 0xffffffff}, // 177
+  {0xffffffff, 0xf87fffff, 0xffffffff, 0x00201fff, 0xf8000010, 0x0000fffe, 0x00000000, 0x00000000}, // 178
+  {0xf9ffff7f, 0x000007db, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 179
+  {0xffffffff, 0x3fff1fff, 0x000043ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 180
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0x00007fff, 0xffffffff, 0x03ffffff}, // 181
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x007f001f, 0x00000000}, // 182
+  {0xffffffff, 0xffffffff, 0x03ff0fff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 183
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03ff0000}, // 184
+  {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0000ffff}, // 185
+  {0x00003e00, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000}, // 186
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000}, // 187
+  {0x000007ff, 0x00008300, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 188
+  {0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // 189
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000}, // 190
+};
+}
@@ -0,0 +1,93 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef PARSER_UNICODE_TABLE_H_
+#define PARSER_UNICODE_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "../utils/utils.h"
+#include "../utils/unicode.h"
+
+namespace rasp {
+
+/**
+ * The two level lookup tables of the unicode properties which are used by the scanner.
+ * The first level maps the page of the code point to the block,
+ * and the second level is the bitmap of the code points in the block.
+ * The tables are generated by tools/gen-unicode-table.py.
+ */
+class UnicodeTable : private Static {
+ public:
+  static const uint8_t kPageBits = 8;
+  static const size_t kBlockCount = 191;
+  static const size_t kIdentifierStartPageCount = 788;
+  static const size_t kIdentifierPartPageCount = 3586;
+  static const size_t kWhiteSpacePageCount = 255;
+
+
+  /**
+   * The IdentifierStart of the ECMAScript, which is the ID_Start and the '$' and the '_'.
+   */
+  RASP_INLINE static bool IsIdentifierStart(UC32 c) {
+    return Lookup(kIdentifierStartPages, kIdentifierStartPageCount, c);
+  }
+
+
+  /**
+   * The IdentifierPart of the ECMAScript, which is the ID_Continue and the ZWNJ and the ZWJ.
+   */
+  RASP_INLINE static bool IsIdentifierPart(UC32 c) {
+    return Lookup(kIdentifierPartPages, kIdentifierPartPageCount, c);
+  }
+
+
+  /**
+   * The WhiteSpace and the LineTerminator of the ECMAScript, which includes the Zs.
+   */
+  RASP_INLINE static bool IsWhiteSpace(UC32 c) {
+    return Lookup(kWhiteSpacePages, kWhiteSpacePageCount, c);
+  }
+
+ private:
+  static const size_t kBlockWords = (1 << kPageBits) / 32;
+  
+  RASP_INLINE static bool Lookup(const uint8_t* pages, size_t page_count, UC32 c) {
+    size_t page = c >> kPageBits;
+    if (page >= page_count) {
+      return false;
+    }
+    const uint32_t* block = kBlocks[pages[page]];
+    return ((block[(c >> 5) & (kBlockWords - 1)] >> (c & 31)) & 1) != 0;
+  }
+  
+  static const uint8_t kIdentifierStartPages[];
+  static const uint8_t kIdentifierPartPages[];
+  static const uint8_t kWhiteSpacePages[];
+  static const uint32_t kBlocks[][kBlockWords];
+};
+}
+
+#endif
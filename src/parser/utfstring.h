@@ -31,26 +31,46 @@
 #include "./uchar.h"
 #include "../utils/unicode.h"
 #include "../utils/utils.h"
+#include "byte-search.h"
 #include "unicode-iterator-adapter.h"
 
 namespace rasp {
 
+/**
+ * Hold the string in the one canonical encoding,
+ * and convert it to the other encoding at the first access of the other view.
+ * The view is dropped when the string is changed.
+ */
 class UtfValueCache {
  public:
-  UtfValueCache() = default;
+  enum class Encoding: uint8_t {
+    UTF8,
+    UTF16
+  };
+
+
+  explicit UtfValueCache(Encoding encoding = Encoding::UTF8)
+      : encoding_(encoding),
+        has_view_(false) {}
 
 
   UtfValueCache(const UtfValueCache& utf_value_cache)
-      : utf8_value_(utf_value_cache.utf8_value_),
+      : encoding_(utf_value_cache.encoding_),
+        has_view_(utf_value_cache.has_view_),
+        utf8_value_(utf_value_cache.utf8_value_),
         utf16_value_(utf_value_cache.utf16_value_) {}
 
   
   UtfValueCache(UtfValueCache&& utf_value_cache) RASP_NOEXCEPT
-      : utf8_value_(std::move(utf_value_cache.utf8_value_)),
+      : encoding_(utf_value_cache.encoding_),
+        has_view_(utf_value_cache.has_view_),
+        utf8_value_(std::move(utf_value_cache.utf8_value_)),
         utf16_value_(std::move(utf_value_cache.utf16_value_)) {}
 
 
   UtfValueCache& operator = (UtfValueCache&& utf_value_cache) {
+    encoding_ = utf_value_cache.encoding_;
+    has_view_ = utf_value_cache.has_view_;
     utf8_value_ = std::move(utf_value_cache.utf8_value_);
     utf16_value_ = std::move(utf_value_cache.utf16_value_);
     return (*this);
@@ -58,47 +78,131 @@ class UtfValueCache {
 
 
   UtfValueCache& operator = (const UtfValueCache& utf_value_cache) {
+    encoding_ = utf_value_cache.encoding_;
+    has_view_ = utf_value_cache.has_view_;
     utf8_value_ = utf_value_cache.utf8_value_;
     utf16_value_ = utf_value_cache.utf16_value_;
     return (*this);
   }
+
+
+  RASP_INLINE Encoding encoding() const {
+    return encoding_;
+  }
   
   
-  RASP_INLINE void append_utf8_value(const char* utf8) {
-    utf8_value_.append(utf8);
+  RASP_INLINE const Utf8String& utf8_value() RASP_NO_SE {
+    if (encoding_ == Encoding::UTF16 && !has_view_) {
+      ConvertToUtf8();
+    }
+    return utf8_value_;
   }
 
 
-  RASP_INLINE const Utf8String& utf8_value() RASP_NO_SE {
-    return utf8_value_;
+  RASP_INLINE const Utf16String& utf16_value() const {
+    if (encoding_ == Encoding::UTF8 && !has_view_) {
+      ConvertToUtf16();
+    }
+    return utf16_value_;
   }
-  
 
-  RASP_INLINE void append_utf16_value(const UC16 uc) {
-    utf16_value_.append(1, uc);
+
+  /**
+   * Append the one character in the canonical encoding.
+   */
+  void Append(UChar uchar) {
+    DropView();
+    if (encoding_ == Encoding::UTF8) {
+      char utf8[4];
+      utf8_value_.append(utf8, uchar.WriteUtf8(utf8));
+    } else if (uchar.IsSurrogatePair()) {
+      utf16_value_.append(1, uchar.ToHighSurrogate());
+      utf16_value_.append(1, uchar.ToLowSurrogate());
+    } else {
+      utf16_value_.append(1, static_cast<UC16>(uchar.uchar()));
+    }
   }
 
 
-  RASP_INLINE const Utf16String& utf16_value() const {
-    return utf16_value_;
+  /**
+   * Append the other string, which is converted if the encoding is different.
+   */
+  void Append(const UtfValueCache& utf_value_cache) {
+    DropView();
+    if (encoding_ == Encoding::UTF8) {
+      utf8_value_.append(utf_value_cache.utf8_value());
+    } else {
+      utf16_value_.append(utf_value_cache.utf16_value());
+    }
   }
 
 
-  RASP_INLINE void Append(const Utf8String& utf8_value, const Utf16String& utf16_value) {
-    utf8_value_.append(utf8_value);
-    utf16_value_.append(utf16_value);
+  /**
+   * Append the utf-8 sequence [begin, end).
+   * The utf-16 string is converted in bulk.
+   */
+  void Append(const char* begin, const char* end) {
+    DropView();
+    if (encoding_ == Encoding::UTF8) {
+      utf8_value_.append(begin, end);
+    } else {
+      AppendUtf16(begin, end, &utf16_value_);
+    }
   }
 
 
   RASP_INLINE void Clear() {
     utf8_value_.clear();
     utf16_value_.clear();
+    has_view_ = false;
   }
   
   
  private:
-  Utf8String utf8_value_;
-  Utf16String utf16_value_;
+  RASP_INLINE void DropView() {
+    if (has_view_) {
+      if (encoding_ == Encoding::UTF8) {
+        Utf16String().swap(utf16_value_);
+      } else {
+        Utf8String().swap(utf8_value_);
+      }
+      has_view_ = false;
+    }
+  }
+
+
+  static void AppendUtf16(const char* begin, const char* end, Utf16String* utf16) {
+    size_t size = utf16->size();
+    utf16->resize(size + (end - begin));
+    UC16* out = &(*utf16)[0];
+    utf16->resize(ByteSearch::ConvertUtf8ToUtf16(begin, end, out + size) - out);
+  }
+
+
+  void ConvertToUtf16() const {
+    AppendUtf16(utf8_value_.data(), utf8_value_.data() + utf8_value_.size(), &utf16_value_);
+    has_view_ = true;
+  }
+
+
+  // The lone surrogate is dropped.
+  void ConvertToUtf8() const {
+    for (size_t i = 0, size = utf16_value_.size(); i < size; i++) {
+      UC16 uc = utf16_value_[i];
+      UC16 trail = i + 1 < size? utf16_value_[i + 1]: 0;
+      utf8_value_.append(utf16::Convertor::Convert(uc, trail).data());
+      if (utf16::IsHighSurrogateUC16(uc) && utf16::IsLowSurrogateUC16(trail)) {
+        i++;
+      }
+    }
+    has_view_ = true;
+  }
+
+  
+  Encoding encoding_;
+  mutable bool has_view_;
+  mutable Utf8String utf8_value_;
+  mutable Utf16String utf16_value_;
 };
 
 
@@ -156,9 +260,20 @@ class Utf16Value {
 };
 
 
+/**
+ * The string which is kept in the one encoding.
+ * The utf-8 is the default, and the use site which mostly reads the utf-16 value
+ * can select the utf-16 by the constructor.
+ */
 class UtfString {
  public:
+  typedef UtfValueCache::Encoding Encoding;
+
   UtfString() = default;
+
+
+  explicit UtfString(Encoding encoding)
+      : utf_value_cache_(encoding) {}
   
   
   UtfString(const char* source) {
@@ -189,19 +304,27 @@ class UtfString {
 
 
   void Initialize(const std::string& str) {
-    typedef std::string::const_iterator Iterator;
-    Iterator end = str.end();
-    UnicodeIteratorAdapter<Iterator> it(str.begin());
-    while (it != end) {
-      (*this) += *it;
-      ++it;
-    }
+    Append(str.data(), str.data() + str.size());
+  }
+
+
+  /**
+   * Append the utf-8 sequence [begin, end).
+   * The invalid sequence is replaced with U+FFFD in the utf-16 form.
+   */
+  RASP_INLINE void Append(const char* begin, const char* end) {
+    utf_value_cache_.Append(begin, end);
   }
 
 
   RASP_INLINE void Clear() {
     utf_value_cache_.Clear();
   }
+
+
+  RASP_INLINE Encoding encoding() const {
+    return utf_value_cache_.encoding();
+  }
   
 
   inline UtfString& operator = (UtfString&& utf_string) {
@@ -211,13 +334,12 @@ class UtfString {
 
 
   inline const UtfString& operator += (const UtfString& utf_string) {
-    utf_value_cache_.Append(utf_string.utf_value_cache_.utf8_value(),
-                            utf_string.utf_value_cache_.utf16_value());
+    utf_value_cache_.Append(utf_string.utf_value_cache_);
     return (*this);
   }
 
 
-  inline const UtfString& operator += (const UChar& uchar) {
+  inline const UtfString& operator += (UChar uchar) {
     Append(uchar);
     return (*this);
   }
@@ -226,14 +348,12 @@ class UtfString {
   inline const UtfString operator + (const UtfString& utf_string) {
     UtfString copied_utf_string((*this));
     copied_utf_string.utf_value_cache_ = utf_value_cache_;
-    copied_utf_string.utf_value_cache_.Append(
-        utf_string.utf_value_cache_.utf8_value(),
-        utf_string.utf_value_cache_.utf16_value());
+    copied_utf_string.utf_value_cache_.Append(utf_string.utf_value_cache_);
     return copied_utf_string;
   }
 
 
-  inline const UtfString operator + (const UChar& uchar) {
+  inline const UtfString operator + (UChar uchar) {
     UtfString copied_utf_string((*this));
     copied_utf_string.utf_value_cache_ = utf_value_cache_;
     copied_utf_string.Append(uchar);
@@ -262,14 +382,8 @@ class UtfString {
   
  private:
 
-  void Append(const UChar& uchar) {
-    utf_value_cache_.append_utf8_value(uchar.utf8());
-    if (uchar.IsSurrogatePair()) {
-      utf_value_cache_.append_utf16_value(uchar.ToHighSurrogate());
-      utf_value_cache_.append_utf16_value(uchar.ToLowSurrogate());
-    } else {
-      utf_value_cache_.append_utf16_value(uchar.uchar());
-    }
+  RASP_INLINE void Append(UChar uchar) {
+    utf_value_cache_.Append(uchar);
   }
 
   
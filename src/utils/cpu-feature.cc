@@ -0,0 +1,86 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "cpu-feature.h"
+#if defined(RASP_X86) && !defined(HAVE___BUILTIN_CPU_SUPPORTS) && defined(HAVE___CPUIDEX)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace rasp {
+
+#if defined(RASP_X86) && defined(HAVE___BUILTIN_CPU_SUPPORTS)
+
+bool CpuFeature::HasSSE2() {
+  // __builtin_cpu_init is required if called before the main.
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse2");
+}
+
+
+bool CpuFeature::HasAVX2() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+
+#elif defined(RASP_X86) && defined(HAVE___CPUIDEX)
+
+bool CpuFeature::HasSSE2() {
+  int info[4];
+  __cpuid(info, 1);
+  return (info[3] & (1 << 26)) != 0;
+}
+
+
+bool CpuFeature::HasAVX2() {
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+
+  // The os must save the ymm registers on the context switch.
+  __cpuid(info, 1);
+  bool osxsave = (info[2] & (1 << 27)) != 0;
+  if (!osxsave || (_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+}
+
+#else
+
+bool CpuFeature::HasSSE2() {
+  return false;
+}
+
+
+bool CpuFeature::HasAVX2() {
+  return false;
+}
+
+#endif
+
+}
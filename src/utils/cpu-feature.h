@@ -0,0 +1,61 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef UTILS_CPU_FEATURE_H_
+#define UTILS_CPU_FEATURE_H_
+#include "utils.h"
+
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+#define RASP_X86
+#endif
+
+
+// Compile the function with the instruction set which is not enabled by the command line.
+// The caller must check the instruction set by CpuFeature before call the function.
+#if defined(RASP_X86) && defined(__GNUC__)
+#define RASP_TARGET(feature) __attribute__((target(feature)))
+#else
+#define RASP_TARGET(feature)
+#endif
+
+
+namespace rasp {
+
+/**
+ * Detect the instruction sets which are supported by the running cpu.
+ * These functions issue cpuid every time,
+ * so the caller should cache the result.
+ */
+class CpuFeature : private Static {
+ public:
+  static bool HasSSE2();
+
+
+  static bool HasAVX2();
+};
+
+}
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "mapped-file.h"
+#include "os.h"
+#include "stat.h"
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace rasp {
+
+MappedFile::MappedFile(const char* path)
+    : data_(nullptr),
+      size_(0),
+      mapped_(false) {
+  Stat stat(path);
+  if (!stat.IsExist() || !stat.IsReg() || stat.Size() == 0) {
+    return;
+  }
+  size_t size = stat.Size();
+  
+#ifdef HAVE_MMAP
+  int fd = open(path, O_RDONLY);
+  if (fd != -1) {
+    void* addr = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr != MAP_FAILED) {
+      data_ = static_cast<const char*>(addr);
+      size_ = size;
+      mapped_ = true;
+      return;
+    }
+  }
+#endif
+
+  try {
+    FILE* fp = FOpen(path, "rb");
+    buffer_.resize(size);
+    size_t read = FRead(&buffer_[0], size, sizeof(char), size, fp);
+    FClose(fp);
+    if (read == size) {
+      data_ = buffer_.data();
+      size_ = size;
+    }
+  } catch (const FileIOException& e) {}
+}
+
+
+MappedFile::~MappedFile() {
+#ifdef HAVE_MMAP
+  if (mapped_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+}
+}
@@ -0,0 +1,69 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef UTILS_MAPPED_FILE_H_
+#define UTILS_MAPPED_FILE_H_
+
+#include <string>
+#include "utils.h"
+#include "../config.h"
+
+namespace rasp {
+
+/**
+ * The read only view of the whole file.
+ * The file is memory mapped if the platform has the mmap,
+ * otherwise the file is read into the private buffer.
+ */
+class MappedFile : private Uncopyable {
+ public:
+  explicit MappedFile(const char* path);
+
+
+  ~MappedFile();
+
+
+  RASP_INLINE bool IsOpen() const {
+    return data_ != nullptr;
+  }
+
+
+  RASP_INLINE const char* data() const {
+    return data_;
+  }
+
+
+  RASP_INLINE size_t size() const {
+    return size_;
+  }
+
+ private:
+  const char* data_;
+  size_t size_;
+  bool mapped_;
+  std::string buffer_;
+};
+}
+
+#endif
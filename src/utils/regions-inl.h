@@ -223,6 +223,21 @@ T* Regions::New(Args ... args) {
 }
 
 
+template <typename T, typename ... Args>
+T* Regions::NewWithTrailingSpace(size_t trailing_size, Args ... args) {
+  static_assert(std::is_base_of<RegionalObject, T>::value == true,
+                "The type argument of the rasp::Reigons::New must be derived class of rasp::RegionalObject.");
+  // The block size must be aligned as same as the object size.
+  size_t alloc_size = RASP_ALIGN_OFFSET(sizeof(T) + trailing_size, kAlignment);
+  return new(Allocate(alloc_size)) T(args...);
+}
+
+
+void* Regions::AllocateRaw(size_t size) {
+  return central_arena_->CommitRaw(RASP_ALIGN_OFFSET(size, kAlignment));
+}
+
+
 template <typename T, typename ... Args>
 T* Regions::NewArray(size_t size, Args ... args) {
   static_assert(std::is_base_of<RegionalObject, T>::value == true,
@@ -392,6 +407,11 @@ inline Regions::Header* Regions::CentralArena::Commit(size_t size, size_t defaul
 }
 
 
+void* Regions::CentralArena::CommitRaw(size_t size) {
+  return TlsAlloc()->CommitRaw(size);
+}
+
+
 void Regions::CentralArena::CollectGarbage(Regions::LocalArena* arena) {
   FreeChunkStack* free_chunk_stack = arena->free_chunk_stack();
   for (int i = 0; i < kMaxSmallObjectsCount; i++) {
@@ -525,11 +545,29 @@ Regions::LocalArena::LocalArena(
     Regions::CentralArena* central_arena, HugeChunkAllocator* huge_chunk_allocator)
     : central_arena_(central_arena),
       huge_free_chunk_map_(*huge_chunk_allocator),
+      raw_cursor_(nullptr),
+      raw_end_(nullptr),
       next_(nullptr) {
   lock_.clear();
 }
 
 
+void* Regions::LocalArena::CommitRaw(size_t size) {
+  static const size_t kRawBlockSize = 100 KB;
+  // The huge memory is committed alone not to waste the rest of the current block.
+  if (size > kRawBlockSize) {
+    return mmap_.Commit(size);
+  }
+  if (static_cast<size_t>(raw_end_ - raw_cursor_) < size) {
+    raw_cursor_ = reinterpret_cast<Byte*>(mmap_.Commit(kRawBlockSize));
+    raw_end_ = raw_cursor_ + kRawBlockSize;
+  }
+  Byte* block = raw_cursor_;
+  raw_cursor_ += size;
+  return block;
+}
+
+
 Regions::LocalArena::~LocalArena() {}
 
 
@@ -31,6 +31,7 @@
 #include <cstdint>
 #include <unordered_map>
 #include <atomic>
+#include <limits>
 #include <new>
 #include "utils.h"
 #include "tls.h"
@@ -162,6 +163,26 @@ class Regions : private Uncopyable {
    */
   template <typename T, typename ... Args>
   inline T* NewArray(size_t size, Args ... args);
+
+
+
+  /**
+   * Create new instance which has the extra space just after the instance from Regions heap.
+   * The instance which created by this method
+   * must not use delete or free.
+   * @param trailing_size The byte size of the extra space.
+   */
+  template <typename T, typename ... Args>
+  RASP_INLINE T* NewWithTrailingSpace(size_t trailing_size, Args ... args);
+
+
+  /**
+   * Allocate the raw memory which has no header and is never destructed.
+   * The memory must not be passed to Dealloc, it is released with the Regions
+   * without walking the each allocation.
+   * @param size The byte size of the memory.
+   */
+  RASP_INLINE void* AllocateRaw(size_t size);
   
 
   /**
@@ -216,6 +237,138 @@ class Regions : private Uncopyable {
   RASP_INLINE double real_commited_mbytes() RASP_NO_SE {
     return static_cast<double>(allocator_.real_commited_size()) / 1024 / 1024;
   }
+
+
+  /**
+   * The std allocator which allocates the memory from the Regions.
+   * If the Regions is nullptr, the memory is allocated by the operator new,
+   * so the container can be used without the Regions.
+   * The deallocated memory is returned to the free list of the Regions.
+   */
+  template <class T>
+  class RegionsStandardAllocator {
+   public:
+    typedef size_t  size_type;
+    typedef ptrdiff_t difference_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T value_type;
+
+    template <class U>
+    struct rebind { 
+      typedef RegionsStandardAllocator<U> other;
+    };
+
+    explicit RegionsStandardAllocator(Regions* regions = nullptr)
+        : regions_(regions){}
+
+
+    RegionsStandardAllocator(const RegionsStandardAllocator& allocator)
+        : regions_(allocator.regions_){}
+
+
+    template <typename U>
+    RegionsStandardAllocator(const RegionsStandardAllocator<U>& allocator)
+        : regions_(allocator.regions()){}
+    
+
+    /**
+     * Allocate new memory.
+     */
+    pointer allocate(size_type num, const void* hint = 0) {
+      if (regions_ == nullptr) {
+        return static_cast<pointer>(::operator new(sizeof(T) * num));
+      }
+      Block* block = regions_->NewWithTrailingSpace<Block>(sizeof(T) * num);
+      return reinterpret_cast<pointer>(block->value());
+    }
+
+    /**
+     * Initialize already allocated block.
+     */
+    template <typename U, typename ... Args>
+    void construct(U* p, Args&& ... args) {
+      new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Return object address.
+     */
+    pointer address(reference value) const { 
+      return &value; 
+    }
+
+    /**
+     * Return const object address.
+     */
+    const_pointer address(const_reference value) const { 
+      return &value;
+    }
+
+    /**
+     * Remove pointer.
+     */
+    template <typename U>
+    void destroy(U* p) {
+      p->~U();
+    }
+
+    /**
+     * Return the memory to the Regions.
+     */
+    void deallocate(pointer p, size_type n) {
+      if (regions_ == nullptr) {
+        ::operator delete(static_cast<void*>(p));
+        return;
+      }
+      regions_->Dealloc(Block::FromValue(p));
+    }
+
+    /**
+     * Return the max size of allocatable.
+     */
+    size_type max_size() const throw() {
+      return std::numeric_limits<size_t>::max() / sizeof(T);
+    }
+
+
+    Regions* regions() const {return regions_;}
+
+
+    template <typename U>
+    bool operator == (const RegionsStandardAllocator<U>& allocator) const {
+      return regions_ == allocator.regions();
+    }
+
+
+    template <typename U>
+    bool operator != (const RegionsStandardAllocator<U>& allocator) const {
+      return regions_ != allocator.regions();
+    }
+
+   private:
+    /**
+     * The header of the memory which is followed by the elements.
+     */
+    class Block : public RegionalObject {
+     public:
+      RASP_INLINE void* value() {
+        return reinterpret_cast<Byte*>(this) + kValueOffset;
+      }
+
+
+      RASP_INLINE static Block* FromValue(void* value) {
+        return reinterpret_cast<Block*>(reinterpret_cast<Byte*>(value) - kValueOffset);
+      }
+
+     private:
+      static const size_t kValueOffset = RASP_ALIGN_OFFSET(sizeof(RegionalObject), kAlignment);
+    };
+    
+    Regions* regions_;
+  };
   
  private :
 
@@ -479,6 +632,13 @@ class Regions : private Uncopyable {
     inline Regions::Header* Commit(size_t size, size_t default_size);
 
 
+    /**
+     * Get the raw memory which has no header from the thread local arena.
+     * @param size The aligned size.
+     */
+    inline void* CommitRaw(size_t size);
+
+
     /**
      * Remove all arena.
      */
@@ -674,6 +834,14 @@ class Regions : private Uncopyable {
     }
 
 
+    /**
+     * Cut the raw memory from the raw block of this arena.
+     * The raw block is not the Chunk, so it is not walked by the Chunk::Destruct.
+     * @param size The aligned size.
+     */
+    inline void* CommitRaw(size_t size);
+
+
     /**
      * Add The Regions::LocalArena to free list of The Regions::CentralArena.
      */
@@ -685,6 +853,8 @@ class Regions : private Uncopyable {
     ChunkList chunk_list_;
     FreeChunkStack free_chunk_stack_[kMaxSmallObjectsCount];
     HugeChunkMap huge_free_chunk_map_;
+    Byte* raw_cursor_;
+    Byte* raw_end_;
     LocalArena* next_;
   };
   
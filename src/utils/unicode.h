@@ -168,6 +168,19 @@ RASP_INLINE bool IsLowSurrogateUC16(UC16 uc) {
 }
 
 
+/**
+ * Convert the utf-16 surrogate pair to the utf-32 char.
+ * @param high The high surrogate.
+ * @param low The low surrogate.
+ * @return The code point.
+ */
+RASP_INLINE UC32 FromSurrogatePairUC16(UC16 high, UC16 low) {
+  using namespace unicode;
+  return (u32(high & kHighSurrogateMask) << kSurrogateBits)
+      + u32(low & kLowSurrogateMask) + 0x10000;
+}
+
+
 class Convertor : private Static {
  public:
   static UC8Bytes Convert(UC16 uc, UC16 trail) {
@@ -192,9 +205,7 @@ class Convertor : private Static {
  private:
 
   RASP_INLINE static UC32 UC16ToUC32SurrogatePair(UC16 high, UC16 low) {
-    using namespace unicode;
-    return (u32(high & kHighSurrogateMask) << kSurrogateBits)
-        + u32(low & kLowSurrogateMask) + 0x10000;
+    return FromSurrogatePairUC16(high, low);
   }
 
   
@@ -288,6 +299,63 @@ RASP_INLINE bool IsValidSequence(UC8 uc) {
  */
 template <typename T>
 RASP_INLINE bool IsAscii(T uc) {return uc < unicode::kAsciiMax;}
+
+
+/**
+ * Decode the utf-8 byte sequence which is already validated, e.g. by SourceStream.
+ * @param it The front of the sequence.
+ * @param byte_count The byte count of the sequence, which is returned by GetByteCount.
+ * @return The code point.
+ */
+RASP_INLINE UC32 DecodeUnchecked(const char* it, size_t byte_count) {
+  UC32 c = static_cast<UC8>(it[0]);
+  switch (byte_count) {
+    case 2:
+      return (unicode::Mask<5>(c) << 6) | unicode::Mask<6>(it[1]);
+    case 3:
+      return (unicode::Mask<4>(c) << 12) | (unicode::Mask<6>(it[1]) << 6) | unicode::Mask<6>(it[2]);
+    case 4:
+      return (unicode::Mask<3>(c) << 18) | (unicode::Mask<6>(it[1]) << 12) |
+          (unicode::Mask<6>(it[2]) << 6) | unicode::Mask<6>(it[3]);
+    default:
+      return c;
+  }
+}
+
+
+/**
+ * Encode the code point to the utf-8 byte sequence.
+ * The surrogates and the code points over U+10FFFF have no utf-8 form, so nothing is written.
+ * @param uc The code point.
+ * @param out The buffer which has a room for 4 bytes.
+ * @return The byte count of the written sequence.
+ */
+RASP_INLINE size_t Encode(UC32 uc, char* out) {
+  using namespace unicode;
+  if (uc < 0x80) {
+    out[0] = static_cast<char>(uc);
+    return 1;
+  } else if (uc < 0x800) {
+    out[0] = static_cast<char>((uc >> 6) | 0xC0);
+    out[1] = static_cast<char>((uc & 0x3F) | 0x80);
+    return 2;
+  } else if (uc < 0x10000) {
+    if (!utf16::IsOutOfSurrogateRange(uc)) {
+      return 0;
+    }
+    out[0] = static_cast<char>((uc >> 12) | 0xE0);
+    out[1] = static_cast<char>(((uc >> 6) & 0x3F) | 0x80);
+    out[2] = static_cast<char>((uc & 0x3F) | 0x80);
+    return 3;
+  } else if (uc <= kUnicodeMax) {
+    out[0] = static_cast<char>((uc >> 18) | 0xF0);
+    out[1] = static_cast<char>(((uc >> 12) & 0x3F) | 0x80);
+    out[2] = static_cast<char>(((uc >> 6) & 0x3F) | 0x80);
+    out[3] = static_cast<char>((uc & 0x3F) | 0x80);
+    return 4;
+  }
+  return 0;
+}
 } //namespace utf8
 
 } //namespace rasp
@@ -0,0 +1,108 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../src/parser/atom-table.h"
+#include "../../src/utils/systeminfo.h"
+
+namespace {
+static const size_t kIdentifierCount = 10000;
+
+std::string Identifier(size_t index) {
+  return "identifier" + std::to_string(index);
+}
+}
+
+
+TEST(AtomTableTest, Intern) {
+  rasp::AtomTable table;
+  rasp::Atom foo = table.Intern("foo", 3);
+  rasp::Atom bar = table.Intern("bar", 3);
+  ASSERT_NE(rasp::AtomTable::kInvalidAtom, foo);
+  ASSERT_NE(rasp::AtomTable::kInvalidAtom, bar);
+  ASSERT_NE(foo, bar);
+  ASSERT_EQ(foo, table.Intern("foo", 3));
+  ASSERT_EQ(foo, table.Intern("foobar", 3));
+  ASSERT_EQ(2u, table.size());
+}
+
+
+TEST(AtomTableTest, Find) {
+  rasp::AtomTable table;
+  ASSERT_EQ(rasp::AtomTable::kInvalidAtom, table.Find("foo", 3));
+  rasp::Atom foo = table.Intern("foo", 3);
+  ASSERT_EQ(foo, table.Find("foo", 3));
+  ASSERT_EQ(rasp::AtomTable::kInvalidAtom, table.Find("fo", 2));
+}
+
+
+TEST(AtomTableTest, Intern_collision) {
+  // Only one bucket, so all identifiers are in the same chain.
+  rasp::AtomTable table(1);
+  std::vector<rasp::Atom> atoms;
+  for (size_t i = 0; i < 100; i++) {
+    std::string identifier = Identifier(i);
+    atoms.push_back(table.Intern(identifier.data(), identifier.size()));
+  }
+  for (size_t i = 0; i < 100; i++) {
+    std::string identifier = Identifier(i);
+    ASSERT_EQ(atoms[i], table.Find(identifier.data(), identifier.size()));
+  }
+  ASSERT_EQ(100u, table.size());
+}
+
+
+TEST(AtomTableTest, Intern_thread) {
+  rasp::AtomTable table(64);
+  size_t thread_count = rasp::SystemInfo::GetOnlineProcessorCount() + 1;
+  std::vector<std::vector<rasp::Atom>> results(thread_count);
+  std::atomic<bool> start(false);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; t++) {
+    threads.emplace_back([&, t]() {
+      while (!start.load()) {}
+      for (size_t i = 0; i < kIdentifierCount; i++) {
+        // Each thread inserts the identifiers in the different order.
+        std::string identifier = Identifier((i + t * 7) % kIdentifierCount);
+        results[t].push_back(table.Intern(identifier.data(), identifier.size()));
+      }
+    });
+  }
+  start.store(true);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(kIdentifierCount, table.size());
+  for (size_t t = 0; t < thread_count; t++) {
+    for (size_t i = 0; i < kIdentifierCount; i++) {
+      std::string identifier = Identifier((i + t * 7) % kIdentifierCount);
+      ASSERT_EQ(table.Find(identifier.data(), identifier.size()), results[t][i]);
+    }
+  }
+}
@@ -0,0 +1,272 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include "../../src/parser/byte-search.h"
+
+namespace {
+typedef rasp::ByteSearch::InstructionSet InstructionSet;
+typedef const char* (*Search)(const char*, const char*);
+
+// Run the search with all instruction sets which are supported by the cpu,
+// and check the result at the all start positions.
+void SearchTest(const std::string& str, Search search, size_t expected) {
+  static const InstructionSet kSets[] = {InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2};
+  InstructionSet original = rasp::ByteSearch::instruction_set();
+  const char* begin = str.data();
+  const char* end = begin + str.size();
+  for (InstructionSet set : kSets) {
+    if (!rasp::ByteSearch::Use(set)) {
+      continue;
+    }
+    for (size_t i = 0; i <= expected; i++) {
+      ASSERT_EQ(begin + expected, search(begin + i, end))
+          << "instruction set: " << static_cast<int>(set) << " start: " << i;
+    }
+  }
+  rasp::ByteSearch::Use(original);
+}
+
+
+std::string Repeat(const char* str, size_t count) {
+  std::string ret;
+  for (size_t i = 0; i < count; i++) {
+    ret += str;
+  }
+  return ret;
+}
+
+
+// Validate the str from the front with all instruction sets which are supported by the cpu.
+void ValidateTest(const std::string& str, size_t expected) {
+  static const InstructionSet kSets[] = {InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2};
+  InstructionSet original = rasp::ByteSearch::instruction_set();
+  const char* begin = str.data();
+  for (InstructionSet set : kSets) {
+    if (!rasp::ByteSearch::Use(set)) {
+      continue;
+    }
+    ASSERT_EQ(begin + expected, rasp::ByteSearch::FindInvalidUtf8(begin, begin + str.size()))
+        << "instruction set: " << static_cast<int>(set) << " size: " << str.size();
+  }
+  rasp::ByteSearch::Use(original);
+}
+
+
+// Convert the str with all instruction sets which are supported by the cpu.
+void ConvertTest(const std::string& str, const rasp::Utf16String& expected) {
+  static const InstructionSet kSets[] = {InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2};
+  InstructionSet original = rasp::ByteSearch::instruction_set();
+  const char* begin = str.data();
+  for (InstructionSet set : kSets) {
+    if (!rasp::ByteSearch::Use(set)) {
+      continue;
+    }
+    rasp::Utf16String out(str.size(), 0);
+    rasp::UC16* last = rasp::ByteSearch::ConvertUtf8ToUtf16(begin, begin + str.size(), &out[0]);
+    out.resize(last - &out[0]);
+    ASSERT_TRUE(expected == out) << "instruction set: " << static_cast<int>(set) << " size: " << str.size();
+  }
+  rasp::ByteSearch::Use(original);
+}
+}
+
+
+TEST(ByteSearchTest, FindLineTerminator) {
+  for (size_t i = 0; i < 70; i++) {
+    SearchTest(Repeat("a", i) + "\nabc", rasp::ByteSearch::FindLineTerminator, i);
+    SearchTest(Repeat("a", i) + "\r\nabc", rasp::ByteSearch::FindLineTerminator, i);
+    SearchTest(Repeat("a", i) + std::string(1, '\0') + "abc", rasp::ByteSearch::FindLineTerminator, i);
+  }
+}
+
+
+TEST(ByteSearchTest, FindLineTerminator_not_found) {
+  for (size_t i = 0; i < 70; i++) {
+    SearchTest(Repeat("a", i), rasp::ByteSearch::FindLineTerminator, i);
+  }
+}
+
+
+TEST(ByteSearchTest, FindMultiLineCommentEnd) {
+  for (size_t i = 0; i < 70; i++) {
+    SearchTest(Repeat("*", i) + "*/abc", rasp::ByteSearch::FindMultiLineCommentEnd, i);
+    SearchTest(Repeat("/", i) + "*/", rasp::ByteSearch::FindMultiLineCommentEnd, i);
+    SearchTest(Repeat("a", i) + std::string(1, '\0') + "*/", rasp::ByteSearch::FindMultiLineCommentEnd, i);
+  }
+}
+
+
+TEST(ByteSearchTest, FindMultiLineCommentEnd_not_found) {
+  for (size_t i = 0; i < 70; i++) {
+    SearchTest(Repeat("* /", i) + "*", rasp::ByteSearch::FindMultiLineCommentEnd, i * 3 + 1);
+  }
+}
+
+
+TEST(ByteSearchTest, SkipWhiteSpace) {
+  for (size_t i = 0; i < 70; i++) {
+    SearchTest(Repeat(" ", i) + "abc", rasp::ByteSearch::SkipWhiteSpace, i);
+    SearchTest(Repeat("\t\v\f ", i) + "\n ", rasp::ByteSearch::SkipWhiteSpace, i * 4);
+    SearchTest(Repeat(" ", i), rasp::ByteSearch::SkipWhiteSpace, i);
+  }
+}
+
+
+TEST(ByteSearchTest, FindStringLiteralSpecial) {
+  static const char* kSpecials[] = {"'", "\\", "\n", "\r", "\xe3\x81\x82"};
+  auto search = [](const char* begin, const char* end) {
+    return rasp::ByteSearch::FindStringLiteralSpecial(begin, end, '\'');
+  };
+  for (size_t i = 0; i < 70; i++) {
+    for (const char* special : kSpecials) {
+      SearchTest(Repeat("\"a", i) + special + "abc", search, i * 2);
+    }
+    SearchTest(Repeat("a", i) + std::string(1, '\0') + "'", search, i);
+    SearchTest(Repeat("\"", i), search, i);
+  }
+}
+
+
+TEST(ByteSearchTest, CountCharacters) {
+  std::string str = "a\xe3\x81\x82" "b\xf0\x9f\x98\x80" "c";
+  ASSERT_EQ(5u, rasp::ByteSearch::CountCharacters(str.data(), str.data() + str.size()));
+}
+
+
+TEST(ByteSearchTest, FindNonAscii) {
+  for (size_t i = 0; i < 70; i++) {
+    SearchTest(Repeat("a", i) + "\xe3\x81\x82" + "abc", rasp::ByteSearch::FindNonAscii, i);
+    SearchTest(Repeat("\x7f", i) + "\x80", rasp::ByteSearch::FindNonAscii, i);
+    SearchTest(Repeat("a", i), rasp::ByteSearch::FindNonAscii, i);
+  }
+}
+
+
+TEST(ByteSearchTest, FindInvalidUtf8_valid) {
+  static const char* kChars[] = {"a", "\xc2\x80", "\xdf\xbf", "\xe0\xa0\x80", "\xe3\x81\x82", "\xed\x9f\xbf",
+                                 "\xef\xbf\xbf", "\xf0\x90\x80\x80", "\xf0\x9f\x98\x80", "\xf4\x8f\xbf\xbf"};
+  for (size_t i = 0; i < 70; i++) {
+    for (const char* c : kChars) {
+      ValidateTest(Repeat("a", i) + Repeat(c, 40), i + strlen(c) * 40);
+      ValidateTest(Repeat(c, i), strlen(c) * i);
+    }
+  }
+}
+
+
+TEST(ByteSearchTest, FindInvalidUtf8_invalid) {
+  static const char* kInvalids[] = {
+    "\x80", "\xbf", "\xc0\x80", "\xc1\xbf", "\xc3" "a", "\xc3\xc3\xa9", "\xe0\x80\x80", "\xe0\x9f\xbf",
+    "\xed\xa0\x80", "\xed\xbf\xbf", "\xe3\x81" "a", "\xf0\x80\x80\x80", "\xf0\x8f\xbf\xbf",
+    "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xf0\x9f\x98" "a", "\xf8\x88\x80\x80\x80", "\xfe", "\xff"
+  };
+  for (size_t i = 0; i < 70; i++) {
+    for (const char* invalid : kInvalids) {
+      ValidateTest(Repeat("a", i) + invalid + Repeat("b", 40), i);
+      ValidateTest(Repeat("\xe3\x81\x82", i) + invalid + Repeat("\xc3\xa9", 20), i * 3);
+    }
+    // The truncated sequence at the end.
+    ValidateTest(Repeat("a", i) + "\xe3\x81", i);
+    ValidateTest(Repeat("a", i) + "\xf0\x9f\x98", i);
+    // The continuation byte after the complete sequence.
+    ValidateTest(Repeat("a", i) + "\xe3\x81\x82\x82" + Repeat("b", 40), i + 3);
+  }
+}
+
+
+TEST(ByteSearchTest, FindInvalidUtf8_same_as_scalar) {
+  static const char* kPieces[] = {"a", "\n", "\xc3\xa9", "\xe3\x81\x82", "\xf0\x9f\x98\x80",
+                                  "\x80", "\xe3", "\xf0\x9f", "\xed\xa0\x80", "\xc0\xaf", "\xff"};
+  uint32_t seed = 1;
+  for (int n = 0; n < 2000; n++) {
+    std::string str;
+    size_t length = n % 150;
+    for (size_t i = 0; i < length; i++) {
+      seed = seed * 1103515245 + 12345;
+      // The invalid pieces are rare, so the error is often after the several SIMD blocks.
+      size_t piece = (seed >> 16) % 200;
+      str += kPieces[piece < 195? piece % 5: 5 + piece % 6];
+    }
+    const char* begin = str.data();
+    const char* end = begin + str.size();
+    InstructionSet original = rasp::ByteSearch::instruction_set();
+    rasp::ByteSearch::Use(InstructionSet::SCALAR);
+    size_t expected = rasp::ByteSearch::FindInvalidUtf8(begin, end) - begin;
+    rasp::ByteSearch::Use(original);
+    ValidateTest(str, expected);
+  }
+}
+
+
+TEST(ByteSearchTest, ConvertUtf8ToUtf16) {
+  // The non ascii characters are placed after the SIMD blocks.
+  std::string str = Repeat("abcdefgh", 8) + "\xc3\xa9" "\xe3\x81\x82" "\xf0\x9f\x98\x80" "z";
+  rasp::Utf16String expected;
+  for (char c : Repeat("abcdefgh", 8)) {
+    expected += static_cast<rasp::UC16>(c);
+  }
+  expected += 0xE9;
+  expected += 0x3042;
+  expected += 0xD83D;
+  expected += 0xDE00;
+  expected += 'z';
+  ConvertTest(str, expected);
+  ConvertTest("", rasp::Utf16String());
+}
+
+
+TEST(ByteSearchTest, ConvertUtf8ToUtf16_invalid) {
+  rasp::Utf16String expected;
+  expected += 'a';
+  expected += 0xFFFD;
+  expected += 'b';
+  expected += 0xFFFD;
+  ConvertTest("a\x80" "b\xe3", expected);
+}
+
+
+TEST(ByteSearchTest, ConvertUtf8ToUtf16_same_as_scalar) {
+  static const char* kPieces[] = {"a", "\n", "\xc3\xa9", "\xe3\x81\x82", "\xf0\x9f\x98\x80",
+                                  "\x80", "\xe3", "\xf0\x9f", "\xed\xa0\x80", "\xc0\xaf", "\xff"};
+  uint32_t seed = 1;
+  for (int n = 0; n < 2000; n++) {
+    std::string str;
+    size_t length = n % 150;
+    for (size_t i = 0; i < length; i++) {
+      seed = seed * 1103515245 + 12345;
+      size_t piece = (seed >> 16) % 200;
+      // Most pieces are ascii, so the ascii blocks are widened by the SIMD.
+      str += kPieces[piece < 150? 0: piece < 195? piece % 5: 5 + piece % 6];
+    }
+    InstructionSet original = rasp::ByteSearch::instruction_set();
+    rasp::ByteSearch::Use(InstructionSet::SCALAR);
+    rasp::Utf16String expected(str.size(), 0);
+    expected.resize(rasp::ByteSearch::ConvertUtf8ToUtf16(str.data(), str.data() + str.size(), &expected[0]) - &expected[0]);
+    rasp::ByteSearch::Use(original);
+    ConvertTest(str, expected);
+  }
+}
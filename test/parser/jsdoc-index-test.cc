@@ -0,0 +1,61 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include "../../src/compiler-option.h"
+#include "../../src/parser/jsdoc-index.h"
+#include "../../src/parser/scanner.h"
+
+
+TEST(JSDocIndexTest, Find) {
+  const char* source =
+      "/* license */\n"
+      "/** @type {number} */ var a = 1;\n"
+      "/** ignored */ /** @param {string} b */ function f(b) {}\n"
+      "/* not jsdoc */ var c;\n"
+      "/**/ let d;\n"
+      "/** @const */ a = 2;\n"
+      "/** @const \xe3\x81\x82 */ const e = 3;";
+  rasp::CompilerOption compiler_option;
+  compiler_option.set_language_mode(rasp::LanguageMode::HARMONY);
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  rasp::TokenStream token_stream;
+  scanner.ScanAll(&token_stream);
+
+  rasp::JSDocIndex index(source, token_stream);
+  ASSERT_EQ(index.size(), 3u);
+  EXPECT_EQ(token_stream.type(index.token(0)), rasp::Token::JS_VAR);
+  EXPECT_EQ(token_stream.type(index.token(1)), rasp::Token::JS_FUNCTION);
+  EXPECT_EQ(token_stream.type(index.token(2)), rasp::Token::JS_CONST);
+  EXPECT_STREQ(index.CommentValue(index.Find(index.token(0))).ToUtf8Value().value(),
+               "/** @type {number} */");
+  EXPECT_STREQ(index.CommentValue(index.Find(index.token(1))).ToUtf8Value().value(),
+               "/** @param {string} b */");
+  EXPECT_STREQ(index.CommentValue(index.comment(2)).ToUtf8Value().value(),
+               "/** @const \xe3\x81\x82 */");
+  EXPECT_EQ(index.Find(index.token(0) + 1), rasp::JSDocIndex::kNotFound);
+  EXPECT_EQ(index.Find(token_stream.size()), rasp::JSDocIndex::kNotFound);
+  EXPECT_STREQ(index.CommentValue(0).ToUtf8Value().value(), "/* license */");
+}
@@ -0,0 +1,81 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include "../../src/parser/line-index.h"
+
+
+TEST(LineIndexTest, LineNumber) {
+  const char* source = "a\nbc\r\nd\re\n\nf";
+  rasp::LineIndex line_index(source, source + strlen(source));
+  ASSERT_EQ(6u, line_index.line_count());
+  const size_t lines[] = {1, 1, 2, 2, 2, 2, 3, 3, 4, 4, 5, 6};
+  for (size_t i = 0; i < strlen(source); i++) {
+    ASSERT_EQ(lines[i], line_index.LineNumber(i)) << i;
+  }
+  ASSERT_EQ(6u, line_index.LineNumber(strlen(source)));
+  ASSERT_EQ(6u, line_index.LineStart(3));
+}
+
+
+TEST(LineIndexTest, Column) {
+  const char* source = "ab\n\xe3\x81\x82\xe3\x81\x84" "c\r\n  d";
+  rasp::LineIndex line_index(source, source + strlen(source));
+  ASSERT_EQ(1u, line_index.Column(0));
+  ASSERT_EQ(3u, line_index.Column(2));
+  ASSERT_EQ(1u, line_index.Column(3));
+  ASSERT_EQ(2u, line_index.Column(6));
+  ASSERT_EQ(3u, line_index.Column(9));
+  ASSERT_EQ(3u, line_index.Column(14));
+}
+
+
+TEST(LineIndexTest, Column_long_line) {
+  std::string source = "a\n";
+  for (int i = 0; i < 1000; i++) {
+    source += (i % 7 == 0)? "\xe3\x81\x82": "bc";
+  }
+  rasp::LineIndex line_index(source.data(), source.data() + source.size());
+  size_t column = 1;
+  for (size_t i = 2; i <= source.size(); i++) {
+    ASSERT_EQ(column, line_index.Column(i)) << i;
+    if (i < source.size() && (static_cast<uint8_t>(source[i]) & 0xC0) != 0x80) {
+      column++;
+    }
+  }
+}
+
+
+TEST(LineIndexTest, Reset) {
+  const char* first = "a\nb";
+  const char* second = "a\n\n\nb";
+  rasp::LineIndex line_index(first, first + strlen(first));
+  ASSERT_EQ(2u, line_index.LineNumber(2));
+  line_index.Reset(second, second + strlen(second));
+  ASSERT_EQ(4u, line_index.LineNumber(4));
+  rasp::LineIndex empty;
+  ASSERT_EQ(1u, empty.line_count());
+}
@@ -0,0 +1,131 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include "../../src/parser/numeric-conversion.h"
+
+namespace {
+double ParseDecimal(const std::string& text) {
+  return rasp::NumericConversion::ParseDecimal(text.data(), text.data() + text.size());
+}
+
+
+void ExpectSameAsStrtod(const std::string& text) {
+  double expected = strtod(text.c_str(), nullptr);
+  double actual = ParseDecimal(text);
+  ASSERT_EQ(0, memcmp(&expected, &actual, sizeof(double))) << text << " " << expected << " " << actual;
+}
+}
+
+
+TEST(NumericConversionTest, ParseDecimal) {
+  const char* texts[] = {
+    "0", "1", "10", "123456789", "4294967295", "9007199254740992", "9007199254740993",
+    "18446744073709551615", "18446744073709551616", "123456789012345678901234567890",
+    "0.1", "0.2", "0.3", ".5", "1.5", "3.141592653589793", "2.2250738585072014e-308",
+    "2.2250738585072011e-308", "4.9e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+    "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308", "1e309", "1e-400",
+    "1e22", "1e23", "1e-22", "1e-23", "8.98846567431158e307", "0.000000000000000000000000001",
+    "9007199254740993.0000000000000000001", "1.00000000000000011102230246251565404236316680908203125",
+    "1.00000000000000011102230246251565404236316680908203124", "7.3177701707893310e+15",
+    "1e100000000", "0e100", "00000000000000000000001.5"
+  };
+  for (const char* text: texts) {
+    ExpectSameAsStrtod(text);
+  }
+}
+
+
+TEST(NumericConversionTest, ParseDecimal_random) {
+  std::mt19937_64 random(1234);
+  for (int i = 0; i < 100000; i++) {
+    uint64_t bits = random();
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    if (std::isnan(value) || std::isinf(value)) {
+      continue;
+    }
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*e", static_cast<int>(random() % 20), std::fabs(value));
+    ExpectSameAsStrtod(buffer);
+  }
+  for (int i = 0; i < 100000; i++) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%llu.%llue%d",
+             static_cast<unsigned long long>(random() % 1000000000000ULL),
+             static_cast<unsigned long long>(random() % 100000000ULL),
+             static_cast<int>(random() % 600) - 300);
+    ExpectSameAsStrtod(buffer);
+  }
+}
+
+
+TEST(NumericConversionTest, ParseRadix) {
+  double value;
+  const char* hex = "FFcc33";
+  ASSERT_TRUE(rasp::NumericConversion::ParseRadix(hex, hex + strlen(hex), 4, &value));
+  ASSERT_EQ(0xFFCC33, value);
+  const char* octal = "777";
+  ASSERT_TRUE(rasp::NumericConversion::ParseRadix(octal, octal + strlen(octal), 3, &value));
+  ASSERT_EQ(0777, value);
+  const char* binary = "1011";
+  ASSERT_TRUE(rasp::NumericConversion::ParseRadix(binary, binary + strlen(binary), 1, &value));
+  ASSERT_EQ(11, value);
+  const char* large = "1000000000000000000000";
+  ASSERT_TRUE(rasp::NumericConversion::ParseRadix(large, large + strlen(large), 4, &value));
+  ASSERT_EQ(std::ldexp(1.0, 84), value);
+  const char* rounded = "10000000000000801";
+  ASSERT_TRUE(rasp::NumericConversion::ParseRadix(rounded, rounded + strlen(rounded), 4, &value));
+  ASSERT_EQ(18446744073709555712.0, value);
+  ASSERT_EQ(strtod("0x10000000000000801", nullptr), value);
+  const char* tie = "100000000000008000";
+  ASSERT_TRUE(rasp::NumericConversion::ParseRadix(tie, tie + strlen(tie), 4, &value));
+  ASSERT_EQ(std::ldexp(1.0, 68), value);
+  const char* invalid = "789";
+  ASSERT_FALSE(rasp::NumericConversion::ParseRadix(invalid, invalid + strlen(invalid), 3, &value));
+}
+
+
+TEST(NumericConversionTest, EiselLemire) {
+  std::mt19937_64 random(5678);
+  int decided = 0;
+  for (int i = 0; i < 100000; i++) {
+    uint64_t mantissa = random() % 10000000000000000000ULL + 1;
+    int exponent = static_cast<int>(random() % 580) - 300;
+    double actual;
+    // The algorithm rarely gives up, and then the caller falls back to the strtod.
+    if (rasp::NumericConversion::EiselLemire(mantissa, exponent, &actual)) {
+      std::string text = std::to_string(mantissa) + "e" + std::to_string(exponent);
+      ASSERT_EQ(strtod(text.c_str(), nullptr), actual) << text;
+      decided++;
+    }
+  }
+  ASSERT_GT(decided, 99900);
+}
@@ -0,0 +1,133 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "../../src/compiler-option.h"
+#include "../../src/parser/parallel-scanner.h"
+#include "../../src/parser/scanner.h"
+#include "../readfile.h"
+
+namespace {
+void ScanSameTokensAsSerialScanner(const std::string& source, size_t thread_count, size_t min_segment_size,
+                                   rasp::LanguageMode language_mode = rasp::LanguageMode::ES3) {
+  rasp::CompilerOption compiler_option;
+  compiler_option.set_language_mode(language_mode);
+  rasp::TokenStream expected;
+  rasp::Scanner<const char*> scanner(source.data(), source.data() + source.size(), compiler_option);
+  scanner.ScanAll(&expected);
+
+  rasp::TokenStream actual;
+  rasp::ParallelScanner parallel_scanner(source.data(), source.data() + source.size(),
+                                         compiler_option, thread_count, min_segment_size);
+  parallel_scanner.ScanAll(&actual);
+  
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(expected.type(i), actual.type(i)) << i;
+    ASSERT_EQ(expected.offset(i), actual.offset(i)) << i;
+    ASSERT_EQ(expected.length(i), actual.length(i)) << i;
+    ASSERT_EQ(expected.flags(i), actual.flags(i)) << i;
+    ASSERT_EQ(expected.atom(i), actual.atom(i)) << i;
+  }
+  ASSERT_EQ(expected.comment_count(), actual.comment_count());
+  for (size_t i = 0; i < expected.comment_count(); i++) {
+    ASSERT_EQ(expected.comment_offset(i), actual.comment_offset(i)) << i;
+    ASSERT_EQ(expected.comment_length(i), actual.comment_length(i)) << i;
+    ASSERT_EQ(expected.comment_token(i), actual.comment_token(i)) << i;
+  }
+}
+}
+
+
+TEST(ParallelScannerTest, ScanAll) {
+  std::string source = rasp::testing::ReadFile("test/parser/sourcestream-test-cases/jquery.js");
+  for (size_t thread_count = 1; thread_count <= 16; thread_count *= 2) {
+    ScanSameTokensAsSerialScanner(source, thread_count, 1);
+  }
+}
+
+
+TEST(ParallelScannerTest, ScanAll_wrong_speculation) {
+  // The segments start from the middle of the string literals and the comments.
+  std::string source;
+  for (int i = 0; i < 200; i++) {
+    source += "var a = 'x // y /* z'; /* ' \" */ b += \"'*/ c\" // d ' e\n/** f */ g /* h */\n";
+  }
+  for (size_t thread_count = 2; thread_count <= 64; thread_count *= 2) {
+    ScanSameTokensAsSerialScanner(source, thread_count, 1);
+  }
+
+  rasp::CompilerOption compiler_option;
+  rasp::ParallelScanner parallel_scanner(source.data(), source.data() + source.size(), compiler_option, 64, 1);
+  rasp::TokenStream token_stream;
+  parallel_scanner.ScanAll(&token_stream);
+  EXPECT_EQ(parallel_scanner.segment_count(), 64u);
+  EXPECT_GT(parallel_scanner.rescanned_token_count(), 0u);
+}
+
+
+TEST(ParallelScannerTest, ScanAll_small_source) {
+  std::string source = "a + b";
+  rasp::CompilerOption compiler_option;
+  rasp::ParallelScanner parallel_scanner(source.data(), source.data() + source.size(), compiler_option, 8);
+  EXPECT_EQ(parallel_scanner.segment_count(), 1u);
+  ScanSameTokensAsSerialScanner(source, 8, 1);
+  ScanSameTokensAsSerialScanner("", 8, 1);
+}
+
+
+TEST(ParallelScannerTest, ScanAll_speculation_in_escape_sequence) {
+  // The segment which starts at "0041" is the strict mode octal literal.
+  std::string sources[] = {"x=\"\\u0041\";", "x='\\u0041\\x41' + 01; y = '\\01' /* 01 */ + 0o1"};
+  const rasp::LanguageMode language_modes[] = {rasp::LanguageMode::ES5_STRICT, rasp::LanguageMode::HARMONY};
+  for (const std::string& source: sources) {
+    for (rasp::LanguageMode language_mode: language_modes) {
+      for (size_t thread_count = 2; thread_count <= 32; thread_count *= 2) {
+        ScanSameTokensAsSerialScanner(source, thread_count, 1, language_mode);
+      }
+    }
+  }
+}
+
+
+TEST(ParallelScannerTest, ScanAll_comments) {
+  // The segments which have no token start.
+  ScanSameTokensAsSerialScanner("/**/a", 2, 1);
+  ScanSameTokensAsSerialScanner("a /* b */ /* c */\n/* d */", 4, 1);
+
+  const char* parts[] = {"a", " ", "\n", "/**/", "/* b */", "// c\n", "'d'", "+", "'/*'", "\"*/\""};
+  const size_t part_count = sizeof(parts) / sizeof(parts[0]);
+  uint32_t random = 1;
+  for (int n = 0; n < 500; n++) {
+    std::string source;
+    for (int i = 0; i < 12; i++) {
+      random = random * 1103515245 + 12345;
+      source += parts[(random >> 16) % part_count];
+    }
+    for (size_t thread_count = 2; thread_count <= 8; thread_count *= 2) {
+      ScanSameTokensAsSerialScanner(source, thread_count, 1);
+    }
+  }
+}
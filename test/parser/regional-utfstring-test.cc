@@ -0,0 +1,66 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "../../src/parser/regional-utfstring.h"
+
+
+TEST(RegionalUtfStringTest, inline) {
+  rasp::Regions regions(1024);
+  std::string value(rasp::RegionalUtfString::kInlineCapacity, 'a');
+  rasp::RegionalUtfString str(value.data(), value.size(), &regions);
+  ASSERT_TRUE(str.is_inline());
+  ASSERT_STREQ(value.c_str(), str.value());
+  ASSERT_EQ(value.size(), str.utf8_length());
+  ASSERT_EQ(0u, regions.commited_bytes());
+  rasp::RegionalUtfString empty;
+  ASSERT_TRUE(empty.is_inline());
+  ASSERT_STREQ("", empty.value());
+}
+
+
+TEST(RegionalUtfStringTest, regions) {
+  rasp::Regions regions(1024);
+  std::string value(rasp::RegionalUtfString::kInlineCapacity + 1, 'a');
+  rasp::RegionalUtfString str(value.data(), value.size(), &regions);
+  ASSERT_FALSE(str.is_inline());
+  ASSERT_STREQ(value.c_str(), str.value());
+  ASSERT_EQ(value.size(), str.utf8_length());
+  ASSERT_NE(0u, regions.commited_bytes());
+  // The copy shares the bytes in the Regions.
+  rasp::RegionalUtfString copied = str;
+  ASSERT_EQ(str.value(), copied.value());
+  ASSERT_TRUE(str == copied);
+}
+
+
+TEST(RegionalUtfStringTest, utf_string) {
+  rasp::Regions regions(1024);
+  rasp::UtfString utf_string("\xe3\x81\x82\xe3\x81\x84\xe3\x81\x86\xe3\x81\x88\xe3\x81\x8a\xf0\x9f\x98\x80");
+  rasp::RegionalUtfString str(utf_string, &regions);
+  ASSERT_STREQ(utf_string.ToUtf8Value().value(), str.value());
+  ASSERT_EQ(7u, str.ToUtfString().utf16_length());
+  ASSERT_TRUE(str != rasp::RegionalUtfString("a", 1, &regions));
+}
@@ -0,0 +1,99 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "../../src/compiler-option.h"
+#include "../../src/parser/scan-pipeline.h"
+#include "../../src/parser/scanner.h"
+#include "../readfile.h"
+
+
+TEST(ScanPipelineTest, Run) {
+  const char* jquery = "test/parser/sourcestream-test-cases/jquery.js";
+  const char* not_exists = "test/parser/sourcestream-test-cases/not-exists.js";
+  std::vector<std::string> paths;
+  for (int i = 0; i < 64; i++) {
+    paths.push_back(i % 16 == 15? not_exists: jquery);
+  }
+
+  rasp::CompilerOption compiler_option;
+  rasp::SourceStream source_stream(jquery);
+  rasp::Scanner<const char*> scanner(source_stream.raw_begin(), source_stream.raw_end(), compiler_option);
+  rasp::TokenStream expected;
+  scanner.ScanAll(&expected);
+  
+  rasp::ScanPipeline scan_pipeline(compiler_option, 4);
+  size_t index = 0;
+  scan_pipeline.Run(paths, [&](const rasp::ScanPipeline::Result& result) {
+    ASSERT_EQ(result.path(), paths[index]);
+    if (index % 16 == 15) {
+      ASSERT_FALSE(result.success());
+      ASSERT_EQ(result.token_stream().size(), 0u);
+    } else {
+      ASSERT_TRUE(result.success());
+      const rasp::TokenStream& actual = result.token_stream();
+      ASSERT_EQ(expected.size(), actual.size());
+      for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected.type(i), actual.type(i)) << i;
+        ASSERT_EQ(expected.offset(i), actual.offset(i)) << i;
+        ASSERT_EQ(expected.length(i), actual.length(i)) << i;
+        ASSERT_EQ(expected.flags(i), actual.flags(i)) << i;
+      }
+    }
+    index++;
+  });
+  ASSERT_EQ(index, paths.size());
+}
+
+
+TEST(ScanPipelineTest, Run_utf16) {
+  const char* utf8 = "test/parser/sourcestream-test-cases/utf8.js";
+  std::vector<std::string> paths;
+  paths.push_back("test/parser/sourcestream-test-cases/utf16le.js");
+  paths.push_back("test/parser/sourcestream-test-cases/utf16be.js");
+
+  rasp::CompilerOption compiler_option;
+  rasp::SourceStream source_stream(utf8);
+  rasp::Scanner<const char*> scanner(source_stream.raw_begin(), source_stream.raw_end(), compiler_option);
+  rasp::TokenStream expected;
+  scanner.ScanAll(&expected);
+
+  rasp::ScanPipeline scan_pipeline(compiler_option, 2);
+  size_t count = 0;
+  scan_pipeline.Run(paths, [&](const rasp::ScanPipeline::Result& result) {
+    ASSERT_TRUE(result.success());
+    ASSERT_TRUE(result.source_stream().utf16());
+    const rasp::TokenStream& actual = result.token_stream();
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+      ASSERT_EQ(expected.type(i), actual.type(i)) << i;
+    }
+    // The offset of the "var" is after the byte order mark.
+    ASSERT_EQ(1u, actual.offset(0));
+    count++;
+  });
+  ASSERT_EQ(paths.size(), count);
+}
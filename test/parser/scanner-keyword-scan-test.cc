@@ -94,3 +94,28 @@ KEYWORD_TEST(with, JS_WITH);
 KEYWORD_TEST(yield, JS_YIELD);
 
 
+#define HARMONY_KEYWORD_TEST(keyword, token_type)               \
+  TEST(ScannerTest, ScanIdentifier_harmony_keyword_##keyword)   \
+  {                                                             \
+    INIT_HARMONY(token, #keyword);                              \
+    ASSERT_EQ(rasp::Token::token_type, token->type());           \
+    END_SCAN;                                                   \
+  }
+
+HARMONY_KEYWORD_TEST(export, JS_EXPORT);
+HARMONY_KEYWORD_TEST(import, JS_IMPORT);
+HARMONY_KEYWORD_TEST(let, JS_LET);
+HARMONY_KEYWORD_TEST(class, FUTURE_RESERVED_WORD);
+
+
+TEST(ScannerTest, ScanIdentifier_not_keyword) {
+  static const char* kIdentifiers[] = {
+    "b", "br", "brea", "breaks", "Break", "iff", "f", "nan", "undefine", "undefinedd", "instanceOf", "yields"
+  };
+  for (const char* identifier : kIdentifiers) {
+    ASSERT_EQ(rasp::Token::JS_IDENTIFIER, rasp::TokenInfo::GetIdentifierType(identifier))
+        << identifier;
+    ASSERT_EQ(rasp::Token::JS_IDENTIFIER, rasp::TokenInfo::GetIdentifierType(identifier, true))
+        << identifier;
+  }
+}
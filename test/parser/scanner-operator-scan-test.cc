@@ -82,3 +82,71 @@ OPERATOR_TEST(">=", greater_equal, JS_GREATER_EQUAL)
 OPERATOR_TEST(">>", shift_right, JS_SHIFT_RIGHT)
 OPERATOR_TEST(">>>", u_shift_right, JS_U_SHIFT_RIGHT)
 OPERATOR_TEST(">>=", shift_right_let, JS_SHIFT_RIGHT_LET)
+OPERATOR_TEST(">>>=", u_shift_right_let, JS_U_SHIFT_RIGHT_LET)
+
+OPERATOR_TEST("(", left_paren, JS_LEFT_PAREN)
+OPERATOR_TEST(")", right_paren, JS_RIGHT_PAREN)
+OPERATOR_TEST(":", colon, JS_COLON)
+OPERATOR_TEST("?", question_mark, JS_QUESTION_MARK)
+OPERATOR_TEST("[", left_bracket, JS_LEFT_BRACKET)
+OPERATOR_TEST("]", right_bracket, JS_RIGHT_BRACKET)
+OPERATOR_TEST("{", left_brace, JS_LEFT_BRACE)
+OPERATOR_TEST("}", right_brace, JS_RIGHT_BRACE)
+
+
+#define HARMONY_OPERATOR_TEST(operator, name, token_type)   \
+  TEST(ScannerTest, ScanOperator_harmony_##name)            \
+  {                                                         \
+   INIT_HARMONY(token, operator);                           \
+   ASSERT_EQ(token->type(), rasp::Token::token_type);        \
+  }
+
+
+HARMONY_OPERATOR_TEST("=>", function_glyph, JS_FUNCTION_GLYPH)
+HARMONY_OPERATOR_TEST("...", rest_parameter, JS_REST_PARAMETER)
+HARMONY_OPERATOR_TEST(">>>=", u_shift_right_let, JS_U_SHIFT_RIGHT_LET)
+
+
+TEST(ScannerTest, ScanOperator_function_glyph_is_harmony_only) {
+  INIT(token, "=>");
+  ASSERT_EQ(token->type(), rasp::Token::JS_ASSIGN);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_GREATER);
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, ScanOperator_longest_match) {
+  INIT(token, "a>>>=b!===c<<=(d)");
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_U_SHIFT_RIGHT_LET);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_NOT_EQ);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_ASSIGN);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_SHIFT_LEFT_LET);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_LEFT_PAREN);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_RIGHT_PAREN);
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, ScanOperator_raw_longest_match) {
+  INIT_RAW(token, "a>>>=b!===c<<=(d)");
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  const rasp::TokenInfo* t = scanner.Scan();
+  ASSERT_EQ(t->type(), rasp::Token::JS_U_SHIFT_RIGHT_LET);
+  ASSERT_EQ(t->source_offset(), 1u);
+  ASSERT_EQ(t->source_length(), 4u);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  t = scanner.Scan();
+  ASSERT_EQ(t->type(), rasp::Token::JS_NOT_EQ);
+  ASSERT_EQ(t->source_length(), 3u);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_ASSIGN);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_SHIFT_LEFT_LET);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_LEFT_PAREN);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_RIGHT_PAREN);
+  END_SCAN;
+}
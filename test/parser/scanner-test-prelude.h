@@ -40,9 +40,17 @@
   rasp::Scanner<Iterator> scanner(v__.begin(), v__.end(), compiler_option); \
   auto var = scanner.Scan();
 
+#define INIT_RAW__(var, str, type)                                      \
+  const char* raw__ = str;                                              \
+  rasp::CompilerOption compiler_option;                                 \
+  compiler_option.set_language_mode(type);                              \
+  rasp::Scanner<const char*> scanner(raw__, raw__ + strlen(raw__), compiler_option); \
+  auto var = scanner.Scan();
+
 #define INIT(var, str) INIT__(var, str, rasp::LanguageMode::ES3)
 #define INIT_STRICT(var, str) INIT__(var, str, rasp::LanguageMode::ES5_STRICT)
 #define INIT_HARMONY(var, str) INIT__(var, str, rasp::LanguageMode::HARMONY)
+#define INIT_RAW(var, str) INIT_RAW__(var, str, rasp::LanguageMode::ES3)
 
 
 #define END_SCAN                                  \
@@ -23,7 +23,11 @@
  */
 
 
+#include <string>
+#include <vector>
 #include "./scanner-test-prelude.h"
+#include "../../src/parser/code-unit-iterator-adapter.h"
+#include "../readfile.h"
 
 
 TEST(ScannerTest, ScanStringLiteralTest_normal) {
@@ -111,6 +115,35 @@ TEST(ScannerTest, ScanStringLiteralTest_invalid_ascii_escaped_string3) {
 }
 
 
+TEST(ScannerTest, ScanStringLiteralTest_line_continuation) {
+  INIT(token, "'foo\\\nbar' baz")
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "foo\\\nbar");
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(token->line_number(), 2u);
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, ScanStringLiteralTest_line_terminator) {
+  INIT(token, "'foo\nbar'")
+  ASSERT_EQ(token->type(), rasp::Token::ILLEGAL);
+  ASSERT_STREQ(scanner.message(), "Unterminated string literal.");
+}
+
+
+TEST(ScannerTest, ScanStringLiteralTest_escape_before_quote) {
+  INIT(token, "'\\u0061' '\\x61'")
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "a");
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "a");
+  END_SCAN;
+}
+
+
 TEST(ScannerTest, ScanDigit_double) {
   INIT(token, ".3032")
   ASSERT_EQ(token->type(), rasp::Token::JS_NUMERIC_LITERAL);
@@ -313,6 +346,30 @@ TEST(ScannerTest, ScanIdentifier_identifier_unicode_escape_with_ascii) {
 }
 
 
+TEST(ScannerTest, ScanIdentifier_identifier_non_ascii_unicode_escape) {
+  INIT(token, "\\u65e5\\u672c_\\u0661");
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  rasp::Utf8Value utf8 = token->value().ToUtf8Value();
+  ASSERT_STREQ(utf8.value(), "\xe6\x97\xa5\xe6\x9c\xac_\xd9\xa1");
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, ScanIdentifier_identifier_unicode_escape_not_identifier_start) {
+  INIT(token, "\\u0031abc");
+  ASSERT_EQ(token->type(), rasp::Token::ILLEGAL);
+}
+
+
+TEST(ScannerTest, ScanStringLiteralTest_unicode_escape_not_identifier) {
+  INIT(token, "'\\u0020\\u005c'");
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  rasp::Utf8Value utf8 = token->value().ToUtf8Value();
+  ASSERT_STREQ(utf8.value(), " \\");
+  END_SCAN;
+}
+
+
 TEST(ScannerTest, ScanLineTerminator_line_terminator) {
   INIT(token, "aaa;");
   ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
@@ -454,3 +511,533 @@ TEST(ScannerTest, SkipMultiLineComment_2) {
   ASSERT_EQ(4u, scanner.line_number());
   END_SCAN;
 }
+
+
+TEST(ScannerTest, RawSource_identifier) {
+  INIT_RAW(token, "fooBarBaz");
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  rasp::Utf8Value utf8 = token->value().ToUtf8Value();
+  ASSERT_STREQ(utf8.value(), "fooBarBaz");
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, RawSource_utf8_string_literal) {
+  INIT_RAW(token, "'\xe3\x81\x82\xe3\x81\x84_foo_\xf0\xa0\x80\x8b'");
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  rasp::Utf8Value utf8 = token->value().ToUtf8Value();
+  ASSERT_STREQ(utf8.value(), "\xe3\x81\x82\xe3\x81\x84_foo_\xf0\xa0\x80\x8b");
+  ASSERT_EQ(9u, token->value().utf16_length());
+  END_SCAN;
+}
+
+
+namespace {
+template <typename Scanner>
+void ExpectUtf16Value(Scanner* scanner, const rasp::TokenInfo* token,
+                      const std::vector<rasp::UC16>& expected, const char* utf8) {
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  rasp::Utf16Value utf16 = token->value().ToUtf16Value();
+  ASSERT_EQ(std::vector<rasp::UC16>(utf16.value(), utf16.value() + utf16.size()), expected);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), utf8);
+  ASSERT_EQ(scanner->Scan()->type(), rasp::Token::END_OF_INPUT);
+}
+}
+
+
+TEST(ScannerTest, Escaped_surrogate_pair) {
+  const char* source = "'\\uD83D\\uDE00'";
+  const std::vector<rasp::UC16> expected = {0xD83D, 0xDE00};
+  {
+    INIT_RAW(token, source);
+    ExpectUtf16Value(&scanner, token, expected, "\xf0\x9f\x98\x80");
+  }
+  {
+    INIT(token, source);
+    ExpectUtf16Value(&scanner, token, expected, "\xf0\x9f\x98\x80");
+  }
+}
+
+
+TEST(ScannerTest, Escaped_lone_surrogate) {
+  const char* source = "'a\\uD800b\\uDC00\\u0063'";
+  const std::vector<rasp::UC16> expected = {'a', 0xD800, 'b', 0xDC00, 'c'};
+  {
+    INIT_RAW(token, source);
+    ExpectUtf16Value(&scanner, token, expected, "abc");
+  }
+  {
+    INIT(token, source);
+    ExpectUtf16Value(&scanner, token, expected, "abc");
+  }
+}
+
+
+TEST(ScannerTest, RawSource_utf16_value) {
+  INIT_RAW(token, "'abcdefghijklmnopqrstuvwxyz0123456789\\x41\xf0\x9f\x98\x80" "b'");
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  rasp::Utf16Value utf16 = token->value().ToUtf16Value();
+  ASSERT_EQ(40u, utf16.size());
+  ASSERT_EQ('a', utf16.value()[0]);
+  ASSERT_EQ('9', utf16.value()[35]);
+  ASSERT_EQ('A', utf16.value()[36]);
+  ASSERT_EQ(0xD83D, utf16.value()[37]);
+  ASSERT_EQ(0xDE00, utf16.value()[38]);
+  ASSERT_EQ('b', utf16.value()[39]);
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, RawSource_invalid_utf8_sequence) {
+  INIT_RAW(token, "'\xe3\x81' aaa");
+  ASSERT_EQ(token->type(), rasp::Token::ILLEGAL);
+}
+
+
+TEST(ScannerTest, RawSource_invalid_utf8_byte) {
+  INIT_RAW(token, "a + \xff b + \xe3\x81 c");
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  const rasp::Token expected[] = {
+    rasp::Token::JS_PLUS, rasp::Token::ILLEGAL, rasp::Token::JS_IDENTIFIER, rasp::Token::JS_PLUS,
+    rasp::Token::ILLEGAL, rasp::Token::ILLEGAL
+  };
+  for (rasp::Token type: expected) {
+    ASSERT_EQ(scanner.Scan()->type(), type);
+  }
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "c");
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, RawSource_utf8_validated) {
+  const char* source = "caf\xc3\xa9 = '\xe3\x81\x82\xf0\xa0\x80\x8b' /* \xe6\x97\xa5 */ \xe6\x97\xa5\xe6\x9c\xac";
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<const char*> expected_scanner(source, source + strlen(source), compiler_option);
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  scanner.set_utf8_validated(true);
+  while (1) {
+    const rasp::TokenInfo* expected = expected_scanner.Scan();
+    const rasp::TokenInfo* token = scanner.Scan();
+    ASSERT_EQ(expected->type(), token->type());
+    ASSERT_STREQ(expected->value().ToUtf8Value().value(), token->value().ToUtf8Value().value());
+    ASSERT_STREQ(expected_scanner.last_multi_line_comment().ToUtf8Value().value(),
+                 scanner.last_multi_line_comment().ToUtf8Value().value());
+    if (token->type() == rasp::Token::END_OF_INPUT) {
+      break;
+    }
+  }
+}
+
+
+// Scan the source by the raw scanner and the UChar scanner, and compare the results.
+void ScanSameTokensAsUCharSource(const std::string& source) {
+  std::vector<rasp::UChar> uchars;
+  rasp::UnicodeIteratorAdapter<std::string::const_iterator> it(source.begin());
+  for (auto end = source.end(); it != end; ++it) {
+    uchars.push_back(*it);
+  }
+  // The line number and the column of the each character.
+  std::vector<size_t> lines(1, 1);
+  std::vector<size_t> cols(1, 1);
+  for (size_t i = 0; i < uchars.size(); i++) {
+    bool crlf = uchars[i] == rasp::unicode::u8('\r') && i + 1 < uchars.size() &&
+        uchars[i + 1] == rasp::unicode::u8('\n');
+    if (uchars[i] == rasp::unicode::u8('\n') || (uchars[i] == rasp::unicode::u8('\r') && !crlf)) {
+      lines.push_back(lines.back() + 1);
+      cols.push_back(1);
+    } else {
+      lines.push_back(lines.back());
+      cols.push_back(cols.back() + 1);
+    }
+  }
+  
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<std::vector<rasp::UChar>::iterator> expected_scanner(uchars.begin(), uchars.end(), compiler_option);
+  rasp::Scanner<const char*> scanner(source.data(), source.data() + source.size(), compiler_option);
+  while (1) {
+    const rasp::TokenInfo* expected = expected_scanner.Scan();
+    const rasp::TokenInfo* token = scanner.Scan();
+    ASSERT_EQ(expected->type(), token->type());
+    // The raw scanner computes the position of the front of the token from the LineIndex.
+    ASSERT_EQ(lines[expected->source_offset()], token->line_number());
+    ASSERT_EQ(cols[expected->source_offset()], token->start_col());
+    ASSERT_STREQ(expected->value().ToUtf8Value().value(), token->value().ToUtf8Value().value());
+    ASSERT_EQ(expected_scanner.has_line_terminator_before_next(), scanner.has_line_terminator_before_next());
+    ASSERT_STREQ(expected_scanner.last_multi_line_comment().ToUtf8Value().value(),
+                 scanner.last_multi_line_comment().ToUtf8Value().value());
+    if (token->type() == rasp::Token::END_OF_INPUT) {
+      break;
+    }
+  }
+}
+
+
+TEST(ScannerTest, RawSource_same_tokens_as_uchar_source) {
+  ScanSameTokensAsUCharSource(rasp::testing::ReadFile("test/parser/sourcestream-test-cases/jquery.js"));
+}
+
+
+TEST(ScannerTest, RawSource_skip_white_space_and_comment) {
+  ScanSameTokensAsUCharSource(
+      "    \t  foo //comment \xe3\x81\x82\xe3\x81\x84\r\n"
+      "\f\v                                        bar\n"
+      "/**\r\n * \xe3\x81\x82 doc comment\r * line\n */ baz /* inline */ qux /*/ a */ // end\n"
+      "                                                                  a\t/***************************/b");
+}
+
+
+TEST(ScannerTest, RawSource_string_literal_span) {
+  INIT_RAW(token, "'test string' \"\\u0061\\x62\\'\\\\c\"")
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  ASSERT_FALSE(token->has_escapes());
+  ASSERT_EQ(raw__ + 1, token->raw_value());
+  ASSERT_EQ(11u, token->raw_length());
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "test string");
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_STRING_LITERAL);
+  ASSERT_TRUE(token->has_escapes());
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "ab\\'\\\\c");
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, RawSource_value_span) {
+  INIT_RAW(token, "foo 0x1F 10.5e+3 0777 \\u0069f")
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(0u, token->raw_offset());
+  ASSERT_EQ(3u, token->raw_length());
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "foo");
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_NUMERIC_LITERAL);
+  ASSERT_EQ(4u, token->raw_offset());
+  ASSERT_EQ(4u, token->raw_length());
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "0x1F");
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_NUMERIC_LITERAL);
+  ASSERT_EQ(9u, token->raw_offset());
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "10.5e+3");
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_OCTAL_LITERAL);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "0777");
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_IF);
+  ASSERT_TRUE(token->has_escapes());
+  ASSERT_EQ(7u, token->raw_length());
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, IdentifierAtom) {
+  INIT_RAW(token, "foo bar if foo \\u0062ar")
+  rasp::Atom foo = token->atom();
+  ASSERT_NE(rasp::AtomTable::kInvalidAtom, foo);
+  ASSERT_EQ(foo, rasp::AtomTable::Default()->Find("foo", 3));
+  rasp::Atom bar = scanner.Scan()->atom();
+  ASSERT_NE(foo, bar);
+  ASSERT_EQ(rasp::AtomTable::kInvalidAtom, scanner.Scan()->atom());
+  ASSERT_EQ(foo, scanner.Scan()->atom());
+  ASSERT_EQ(bar, scanner.Scan()->atom());
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, IdentifierAtom_uchar_source) {
+  INIT(token, "foo bar")
+  ASSERT_EQ(rasp::AtomTable::Default()->Intern("foo", 3), token->atom());
+  ASSERT_EQ(rasp::AtomTable::Default()->Intern("bar", 3), scanner.Scan()->atom());
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, RawSource_identifier_and_number) {
+  ScanSameTokensAsUCharSource(
+      "var foo_bar = $baz + _qux; \\u0061bc if \\u0069f f\\u006fr "
+      "0x1f 0XAB 10 10.5 .5 1e10 1.5e-10 0777 0 ");
+}
+
+
+TEST(ScannerTest, RawSource_non_ascii_identifier) {
+  INIT_RAW(token, "\xc3\xb1" "and\xc3\xba \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e x\xd9\xa1");
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "\xc3\xb1" "and\xc3\xba");
+  ASSERT_EQ(rasp::AtomTable::Default()->Find("\xc3\xb1" "and\xc3\xba", 7), token->atom());
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e");
+  token = scanner.Scan();
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "x\xd9\xa1");
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, RawSource_non_ascii_identifier_same_tokens_as_uchar_source) {
+  // U+4E5C and U+013B have the same low byte as the '\\' and the ';'.
+  ScanSameTokensAsUCharSource(
+      "var \xc3\xb1" "and\xc3\xba = \xe6\x97\xa5\xe6\x9c\xac + \\u65e5\\u672c;\n"
+      "\xe4\xb9\x9c \xc4\xbb x\xd9\xa1 \xd9\xa1x a\xcc\x81 \xf0\xa0\x80\x8b");
+}
+
+
+TEST(ScannerTest, RawSource_unicode_white_space) {
+  ScanSameTokensAsUCharSource("a\xc2\xa0" "b\xe3\x80\x80" "c\xef\xbb\xbf" "d\xe2\x80\x89" "e");
+}
+
+
+TEST(ScannerTest, RawSource_unicode_line_terminator) {
+  INIT_RAW(token, "a\xe2\x80\xa8" "b\xe2\x80\xa9" "c d");
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "a");
+  ASSERT_TRUE(scanner.has_line_terminator_before_next());
+  token = scanner.Scan();
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "b");
+  ASSERT_TRUE(scanner.has_line_terminator_before_next());
+  token = scanner.Scan();
+  ASSERT_STREQ(token->value().ToUtf8Value().value(), "c");
+  ASSERT_FALSE(scanner.has_line_terminator_before_next());
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, RawSource_string_literal) {
+  ScanSameTokensAsUCharSource(
+      "'' \"\" 'abc' \"it's\" 'a\\'b\\\\' '\\u0061_foo_\\u0062' '\\x61\\x62\\x63' "
+      "'\xe3\x81\x82\xe3\x81\x84\xe3\x81\x86 aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa' "
+      "'aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\\\\' "
+      "'line\\\r\ncontinuation\\\nand\\\rmore' foo '\\\xe3\x81\x82' bar");
+}
+
+
+TEST(ScannerTest, RawSource_invalid_string_literal) {
+  ScanSameTokensAsUCharSource("foo 'aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\nbar' baz");
+  ScanSameTokensAsUCharSource("foo 'aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\\u006' baz");
+  ScanSameTokensAsUCharSource("foo 'aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\\x6' baz");
+  ScanSameTokensAsUCharSource("foo 'aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+  ScanSameTokensAsUCharSource("foo 'a\\");
+}
+
+
+TEST(ScannerTest, RawSource_unterminated_comment) {
+  ScanSameTokensAsUCharSource("foo /* aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\n");
+  ScanSameTokensAsUCharSource("foo // aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+}
+
+
+TEST(ScannerTest, ScanTokenSequence) {
+  INIT_RAW(token, "foo(bar);a+=b!==c");
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_LEFT_PAREN);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_RIGHT_PAREN);
+  ASSERT_TRUE(scanner.has_line_terminator_before_next());
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_ADD_LET);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_NOT_EQ);
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::JS_IDENTIFIER);
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, Reset) {
+  INIT_RAW(token, "/* comment */ 'unterminated")
+  ASSERT_EQ(token->type(), rasp::Token::ILLEGAL);
+  const char* source = "\n  foo\nbar";
+  rasp::Scanner<const char*> expected_scanner(source, source + strlen(source), compiler_option);
+  scanner.Reset(source, source + strlen(source));
+  for (int i = 0; i < 3; i++) {
+    token = scanner.Scan();
+    const rasp::TokenInfo* expected = expected_scanner.Scan();
+    ASSERT_EQ(expected->type(), token->type());
+    ASSERT_EQ(expected->line_number(), token->line_number());
+    ASSERT_EQ(expected->start_col(), token->start_col());
+    ASSERT_EQ(expected->source_offset(), token->source_offset());
+    ASSERT_EQ(expected_scanner.has_line_terminator_before_next(), scanner.has_line_terminator_before_next());
+  }
+  ASSERT_EQ(token->type(), rasp::Token::END_OF_INPUT);
+  ASSERT_TRUE(scanner.last_multi_line_comment().ToUtf8Value().size() == 0);
+}
+
+
+TEST(ScannerTest, NumericValue) {
+  const char* source = "10 0x1F 10.5e+3 0777 089 .5 1e-3 123456789012345678901234567890";
+  const double values[] = {10, 0x1F, 10.5e+3, 0777, 89, .5, 1e-3, 123456789012345678901234567890.0};
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  std::vector<rasp::UChar> uchars = rasp::testing::AsciiToUCharVector(source);
+  rasp::Scanner<std::vector<rasp::UChar>::iterator> uchar_scanner(uchars.begin(), uchars.end(), compiler_option);
+  for (double value: values) {
+    ASSERT_EQ(value, scanner.Scan()->numeric_value());
+    ASSERT_EQ(value, uchar_scanner.Scan()->numeric_value());
+  }
+}
+
+
+TEST(ScannerTest, NumericValue_binary) {
+  INIT_HARMONY(token, "0o0011101")
+  ASSERT_EQ(29, token->numeric_value());
+  END_SCAN;
+}
+
+
+TEST(ScannerTest, Reset_language_mode) {
+  INIT_RAW(token, "0777")
+  ASSERT_EQ(token->type(), rasp::Token::JS_OCTAL_LITERAL);
+  const char* source = "0777";
+  compiler_option.set_language_mode(rasp::LanguageMode::ES5_STRICT);
+  scanner.Reset(source, source + strlen(source));
+  ASSERT_EQ(scanner.Scan()->type(), rasp::Token::ILLEGAL);
+}
+
+
+namespace {
+template <typename Scanner>
+void RewindScansSameTokens(Scanner* scanner, std::vector<std::string>* identifiers) {
+  // Checkpoint after the "(".
+  scanner->Scan();
+  auto checkpoint = scanner->checkpoint();
+  std::vector<rasp::Token> types;
+  std::vector<size_t> offsets;
+  std::vector<size_t> lines;
+  std::vector<size_t> cols;
+  std::vector<bool> line_terminators;
+  const rasp::TokenInfo* token;
+  do {
+    token = scanner->Scan();
+    if (token->type() == rasp::Token::JS_IDENTIFIER) {
+      identifiers->push_back(token->value().ToUtf8Value().value());
+    }
+    types.push_back(token->type());
+    offsets.push_back(token->source_offset());
+    lines.push_back(token->line_number());
+    cols.push_back(token->start_col());
+    line_terminators.push_back(scanner->has_line_terminator_before_next());
+  } while (token->type() != rasp::Token::END_OF_INPUT);
+  ASSERT_STRNE(scanner->message(), "");
+
+  for (int n = 0; n < 2; n++) {
+    scanner->Rewind(checkpoint);
+    ASSERT_STREQ(scanner->message(), "");
+    size_t identifier = 0;
+    for (size_t i = 0; i < types.size(); i++) {
+      token = scanner->Scan();
+      ASSERT_EQ(types[i], token->type()) << i;
+      if (token->type() == rasp::Token::JS_IDENTIFIER) {
+        ASSERT_STREQ((*identifiers)[identifier++].c_str(), token->value().ToUtf8Value().value()) << i;
+      }
+      ASSERT_EQ(offsets[i], token->source_offset()) << i;
+      ASSERT_EQ(lines[i], token->line_number()) << i;
+      ASSERT_EQ(cols[i], token->start_col()) << i;
+      ASSERT_EQ(line_terminators[i], scanner->has_line_terminator_before_next()) << i;
+    }
+  }
+}
+}
+
+
+TEST(ScannerTest, Rewind) {
+  const char* source = "(a, \xe3\x81\x82" "b) => /* c\n */ a +\n 'd' # 1.5";
+  rasp::CompilerOption compiler_option;
+  compiler_option.set_language_mode(rasp::LanguageMode::HARMONY);
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  std::vector<std::string> identifiers;
+  RewindScansSameTokens(&scanner, &identifiers);
+  ASSERT_EQ(identifiers.size(), 3u);
+  ASSERT_STREQ(identifiers[1].c_str(), "\xe3\x81\x82" "b");
+
+  std::vector<rasp::UChar> uchars = rasp::testing::AsciiToUCharVector(source);
+  rasp::Scanner<std::vector<rasp::UChar>::iterator> uchar_scanner(uchars.begin(), uchars.end(), compiler_option);
+  std::vector<std::string> uchar_identifiers;
+  RewindScansSameTokens(&uchar_scanner, &uchar_identifiers);
+}
+
+
+TEST(ScannerTest, Rewind_comments) {
+  INIT_RAW(token, "x /*b*/ y /*c*/ z");
+  ASSERT_EQ(token->source_offset(), 0u);
+  auto checkpoint = scanner.checkpoint();
+  ASSERT_STREQ(scanner.last_multi_line_comment().ToUtf8Value().value(), "/*b*/");
+  scanner.Scan();
+  ASSERT_STREQ(scanner.last_multi_line_comment().ToUtf8Value().value(), "/*c*/");
+  scanner.Rewind(checkpoint);
+  ASSERT_STREQ(scanner.last_multi_line_comment().ToUtf8Value().value(), "/*b*/");
+
+  rasp::TokenStream token_stream;
+  scanner.ScanAll(&token_stream);
+  ASSERT_EQ(token_stream.size(), 3u);
+  ASSERT_EQ(token_stream.comment_count(), 2u);
+  EXPECT_EQ(token_stream.comment_offset(0), 2u);
+  EXPECT_EQ(token_stream.comment_token(0), 0u);
+  EXPECT_EQ(token_stream.comment_offset(1), 10u);
+  EXPECT_EQ(token_stream.comment_token(1), 1u);
+}
+
+
+TEST(ScannerTest, LastMultiLineComment_decoded_on_demand) {
+  INIT_RAW(token, "a /* \xe3\x81\x82 */ /* b */ c")
+  ASSERT_EQ(token->type(), rasp::Token::JS_IDENTIFIER);
+  ASSERT_STREQ(scanner.last_multi_line_comment().ToUtf8Value().value(), "/* b */");
+  rasp::TokenStream token_stream;
+  scanner.AppendComments(&token_stream);
+  ASSERT_EQ(token_stream.comment_count(), 2u);
+  ASSERT_EQ(token_stream.comment_offset(0), 2u);
+  ASSERT_EQ(token_stream.comment_length(0), 9u);
+  ASSERT_EQ(token_stream.comment_token(0), 0u);
+  scanner.Scan();
+  ASSERT_EQ(scanner.last_multi_line_comment().ToUtf8Value().size(), 0u);
+}
+
+
+namespace {
+// Scan the utf-8 source and the same source in the other encoding, and compare the tokens.
+template <typename CodeUnit>
+void ScanSameTokensAsUtf8Source(const char* utf8, const std::basic_string<CodeUnit>& source) {
+  typedef rasp::CodeUnitIteratorAdapter<CodeUnit> Iterator;
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<const char*> expected_scanner(utf8, utf8 + strlen(utf8), compiler_option);
+  const CodeUnit* begin = source.data();
+  const CodeUnit* end = begin + source.size();
+  rasp::Scanner<Iterator> scanner(Iterator(begin, end), Iterator(end, end), compiler_option);
+  while (1) {
+    const rasp::TokenInfo* expected = expected_scanner.Scan();
+    const rasp::TokenInfo* token = scanner.Scan();
+    ASSERT_EQ(expected->type(), token->type());
+    ASSERT_STREQ(expected->value().ToUtf8Value().value(), token->value().ToUtf8Value().value());
+    if (token->type() == rasp::Token::END_OF_INPUT) {
+      break;
+    }
+  }
+}
+}
+
+
+TEST(ScannerTest, CodeUnit_utf16) {
+  const char* utf8 = "var caf\xc3\xa9 = '\xe6\x97\xa5\xf0\x9f\x98\x80', \xf0\xa0\x80\x80x = 1;";
+  const rasp::UC16 units[] = {'v', 'a', 'r', ' ', 'c', 'a', 'f', 0xE9, ' ', '=', ' ', '\'', 0x65E5, 0xD83D, 0xDE00,
+                              '\'', ',', ' ', 0xD840, 0xDC00, 'x', ' ', '=', ' ', '1', ';'};
+  rasp::Utf16String source(units, units + sizeof(units) / sizeof(units[0]));
+  ScanSameTokensAsUtf8Source(utf8, source);
+
+  // The offsets are counted by the code units.
+  typedef rasp::CodeUnitIteratorAdapter<rasp::UC16> Iterator;
+  rasp::CompilerOption compiler_option;
+  Iterator begin(source.data(), source.data() + source.size());
+  Iterator end(source.data() + source.size(), source.data() + source.size());
+  rasp::Scanner<Iterator> scanner(begin, end, compiler_option);
+  for (int i = 0; i < 5; i++) {
+    scanner.Scan();
+  }
+  const rasp::TokenInfo* token = scanner.Scan();
+  ASSERT_EQ(rasp::Token::JS_IDENTIFIER, token->type());
+  ASSERT_EQ(18u, token->source_offset());
+  ASSERT_EQ(3u, token->source_length());
+}
+
+
+TEST(ScannerTest, CodeUnit_latin1) {
+  const char* utf8 = "var caf\xc3\xa9 = '\xc3\xa0' /* \xc2\xb1 */;";
+  std::string latin1 = "var caf\xe9 = '\xe0' /* \xb1 */;";
+  ScanSameTokensAsUtf8Source(utf8, std::basic_string<rasp::UC8>(latin1.begin(), latin1.end()));
+}
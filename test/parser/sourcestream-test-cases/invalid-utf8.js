@@ -0,0 +1,2 @@
+var a = 'café';
+var b = '(';
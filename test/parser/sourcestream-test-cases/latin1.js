@@ -0,0 +1 @@
+var caf = '';
@@ -0,0 +1,2 @@
+var café = '日';
+// 本
\ No newline at end of file
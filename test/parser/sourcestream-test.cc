@@ -60,3 +60,67 @@ TEST(SourceStream, load_error) {
   ASSERT_EQ(st.size(), 0u);
   ASSERT_GT(st.failed_message().size(), 0U);
 }
+
+
+TEST(SourceStream, read_last_byte) {
+  const char* utf8 = "test/parser/sourcestream-test-cases/utf8.js";
+  rasp::SourceStream st(utf8);
+  ASSERT_TRUE(st.success());
+  ASSERT_EQ(rasp::testing::ReadFile(utf8), std::string(st.raw_begin(), st.raw_end()));
+}
+
+
+TEST(SourceStream, utf8_validated) {
+  rasp::SourceStream ascii(filename);
+  ASSERT_TRUE(ascii.utf8_validated());
+  ASSERT_TRUE(ascii.ascii());
+  rasp::SourceStream utf8("test/parser/sourcestream-test-cases/utf8.js");
+  ASSERT_TRUE(utf8.utf8_validated());
+  ASSERT_FALSE(utf8.ascii());
+}
+
+
+TEST(SourceStream, invalid_utf8) {
+  rasp::SourceStream st("test/parser/sourcestream-test-cases/invalid-utf8.js");
+  ASSERT_FALSE(st.success());
+  ASSERT_FALSE(st.utf8_validated());
+  ASSERT_NE(std::string::npos, st.failed_message().find("offset 26"));
+}
+
+
+TEST(SourceStream, utf16) {
+  rasp::SourceStream le("test/parser/sourcestream-test-cases/utf16le.js");
+  rasp::SourceStream be("test/parser/sourcestream-test-cases/utf16be.js");
+  ASSERT_TRUE(le.success());
+  ASSERT_TRUE(be.success());
+  ASSERT_TRUE(le.encoding() == rasp::SourceStream::Encoding::UTF16LE);
+  ASSERT_TRUE(be.encoding() == rasp::SourceStream::Encoding::UTF16BE);
+  rasp::Utf16String expected(le.utf16_begin(), le.utf16_end());
+  ASSERT_TRUE(expected == rasp::Utf16String(be.utf16_begin(), be.utf16_end()));
+  // The byte order mark is kept, and the characters are in the native byte order.
+  ASSERT_EQ(21u, expected.size());
+  ASSERT_EQ(0xFEFF, expected[0]);
+  ASSERT_EQ('v', expected[1]);
+  ASSERT_EQ(0x65E5, expected[13]);
+}
+
+
+TEST(SourceStream, utf16_odd_length) {
+  rasp::SourceStream st("test/parser/sourcestream-test-cases/utf8.js", rasp::SourceStream::Encoding::UTF16LE);
+  ASSERT_FALSE(st.success());
+  ASSERT_NE(std::string::npos, st.failed_message().find("odd"));
+}
+
+
+TEST(SourceStream, latin1) {
+  const char* latin1 = "test/parser/sourcestream-test-cases/latin1.js";
+  rasp::SourceStream st(latin1, rasp::SourceStream::Encoding::LATIN1);
+  ASSERT_TRUE(st.success());
+  ASSERT_TRUE(st.encoding() == rasp::SourceStream::Encoding::LATIN1);
+  ASSERT_FALSE(st.utf8_validated());
+  ASSERT_EQ(16, st.latin1_end() - st.latin1_begin());
+  ASSERT_EQ(0xE9, st.latin1_begin()[7]);
+  // The latin-1 file is not utf-8.
+  rasp::SourceStream detected(latin1);
+  ASSERT_FALSE(detected.success());
+}
@@ -0,0 +1,139 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../src/compiler-option.h"
+#include "../../src/parser/scanner.h"
+#include "../../src/parser/streaming-scanner.h"
+#include "../readfile.h"
+
+namespace {
+void ScanSameTokensAsScanner(const std::string& source, size_t chunk_size) {
+  rasp::CompilerOption compiler_option;
+  rasp::TokenStream expected;
+  rasp::Scanner<const char*> scanner(source.data(), source.data() + source.size(), compiler_option);
+  scanner.ScanAll(&expected);
+
+  // The token_stream is cleared after each chunk as the consumer of the large source does.
+  std::vector<size_t> offsets;
+  std::vector<size_t> comment_offsets;
+  std::vector<size_t> comment_lengths;
+  std::vector<size_t> comment_tokens;
+  rasp::TokenStream actual;
+  rasp::TokenStream token_stream;
+  rasp::StreamingScanner streaming_scanner(compiler_option);
+  for (size_t i = 0; i < source.size() + chunk_size; i += chunk_size) {
+    if (i < source.size()) {
+      streaming_scanner.Feed(source.data() + i, std::min(chunk_size, source.size() - i), &token_stream);
+    } else {
+      streaming_scanner.Finish(&token_stream);
+    }
+    for (size_t j = 0; j < token_stream.size(); j++) {
+      offsets.push_back(streaming_scanner.base_offset() + token_stream.offset(j));
+    }
+    for (size_t j = 0; j < token_stream.comment_count(); j++) {
+      comment_offsets.push_back(streaming_scanner.base_offset() + token_stream.comment_offset(j));
+      comment_lengths.push_back(token_stream.comment_length(j));
+      comment_tokens.push_back(actual.size() + token_stream.comment_token(j));
+    }
+    actual.Append(token_stream);
+    token_stream.Clear();
+  }
+  
+  ASSERT_EQ(expected.size(), actual.size()) << chunk_size;
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(expected.type(i), actual.type(i)) << chunk_size << ":" << i;
+    ASSERT_EQ(expected.offset(i), offsets[i]) << chunk_size << ":" << i;
+    ASSERT_EQ(expected.length(i), actual.length(i)) << chunk_size << ":" << i;
+    ASSERT_EQ(expected.flags(i), actual.flags(i)) << chunk_size << ":" << i;
+    ASSERT_EQ(expected.atom(i), actual.atom(i)) << chunk_size << ":" << i;
+  }
+  ASSERT_EQ(expected.comment_count(), comment_offsets.size()) << chunk_size;
+  for (size_t i = 0; i < expected.comment_count(); i++) {
+    ASSERT_EQ(expected.comment_offset(i), comment_offsets[i]) << chunk_size << ":" << i;
+    ASSERT_EQ(expected.comment_length(i), comment_lengths[i]) << chunk_size << ":" << i;
+    ASSERT_EQ(expected.comment_token(i), comment_tokens[i]) << chunk_size << ":" << i;
+  }
+}
+}
+
+
+TEST(StreamingScannerTest, Feed) {
+  std::string source = rasp::testing::ReadFile("test/parser/sourcestream-test-cases/jquery.js");
+  for (size_t chunk_size = 1; chunk_size <= source.size(); chunk_size = chunk_size * 4 + 3) {
+    ScanSameTokensAsScanner(source, chunk_size);
+  }
+}
+
+
+TEST(StreamingScannerTest, Feed_suspend_in_token) {
+  // The chunks are split in the middle of the strings, the comments,
+  // the multi byte utf-8 sequences, the operators and the numeric literals.
+  std::string source;
+  for (int i = 0; i < 20; i++) {
+    source += "var a = 'x // y /* z'; /* ' \" */ b >>>= \"'*/ c\" // d ' e\n"
+        "c = 1.5e10 + 0x1F / 2 !== \xe3\x81\x82\xe3\x81\x84 // \xf0\x9f\x98\x80\r\n"
+        "d = /* \xe3\x81\x82\n */ e\n";
+  }
+  for (size_t chunk_size = 1; chunk_size <= 16; chunk_size++) {
+    ScanSameTokensAsScanner(source, chunk_size);
+  }
+}
+
+
+TEST(StreamingScannerTest, Feed_small_source) {
+  ScanSameTokensAsScanner("", 1);
+  ScanSameTokensAsScanner("a", 1);
+  ScanSameTokensAsScanner("a b", 1);
+  ScanSameTokensAsScanner("/* a */", 3);
+}
+
+
+TEST(StreamingScannerTest, Feed_token_text) {
+  rasp::CompilerOption compiler_option;
+  rasp::StreamingScanner streaming_scanner(compiler_option);
+  rasp::TokenStream token_stream;
+  const char* chunks[] = {"var foo", "bar = 'baz' + ", "qux;"};
+  std::string text;
+  for (const char* chunk: chunks) {
+    token_stream.Clear();
+    streaming_scanner.Feed(chunk, strlen(chunk), &token_stream);
+    for (size_t i = 0; i < token_stream.size(); i++) {
+      size_t offset = streaming_scanner.base_offset() + token_stream.offset(i) - streaming_scanner.buffer_offset();
+      text.append(streaming_scanner.buffer() + offset, token_stream.length(i)).append(" ");
+    }
+  }
+  token_stream.Clear();
+  streaming_scanner.Finish(&token_stream);
+  for (size_t i = 0; i < token_stream.size(); i++) {
+    size_t offset = streaming_scanner.base_offset() + token_stream.offset(i) - streaming_scanner.buffer_offset();
+    text.append(streaming_scanner.buffer() + offset, token_stream.length(i)).append(" ");
+  }
+  EXPECT_EQ(text, "var foobar = 'baz' + qux  ");
+  EXPECT_EQ(token_stream.type(token_stream.size() - 1), rasp::Token::END_OF_INPUT);
+}
@@ -0,0 +1,201 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "../../src/compiler-option.h"
+#include "../../src/parser/scanner.h"
+#include "../../src/parser/token-cache.h"
+#include "../readfile.h"
+
+namespace {
+std::string CacheDirectory() {
+  const char* directory = std::getenv("TMPDIR");
+  return directory != nullptr? directory: "/tmp";
+}
+
+
+void ExpectSameTokens(const rasp::TokenStream& expected, const rasp::TokenStream& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(expected.type(i), actual.type(i)) << i;
+    ASSERT_EQ(expected.offset(i), actual.offset(i)) << i;
+    ASSERT_EQ(expected.length(i), actual.length(i)) << i;
+    ASSERT_EQ(expected.flags(i), actual.flags(i)) << i;
+    ASSERT_EQ(expected.atom(i), actual.atom(i)) << i;
+  }
+  ASSERT_EQ(expected.comment_count(), actual.comment_count());
+  for (size_t i = 0; i < expected.comment_count(); i++) {
+    ASSERT_EQ(expected.comment_offset(i), actual.comment_offset(i)) << i;
+    ASSERT_EQ(expected.comment_length(i), actual.comment_length(i)) << i;
+    ASSERT_EQ(expected.comment_token(i), actual.comment_token(i)) << i;
+  }
+}
+
+
+void WriteVarint(uint64_t value, std::string* buffer) {
+  while (value >= 0x80) {
+    buffer->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  buffer->push_back(static_cast<char>(value));
+}
+
+
+/**
+ * Stores the cache of the source and rewrites everything after the header,
+ * which is the magic followed by the version, mode, size and hash varints.
+ */
+std::string RewriteCacheBody(const rasp::TokenCache& token_cache, const std::string& source,
+                             const rasp::CompilerOption& compiler_option, const std::string& body) {
+  rasp::TokenStream scanned;
+  token_cache.Tokenize(source.data(), source.size(), compiler_option, &scanned);
+  std::string path = token_cache.CachePath(source.data(), source.size(), compiler_option.language_mode());
+  std::string content = rasp::testing::ReadFile(path.c_str());
+  size_t header_size = 4;
+  for (int i = 0; i < 4; i++) {
+    while (static_cast<uint8_t>(content[header_size++]) & 0x80) {}
+  }
+  content = content.substr(0, header_size) + body;
+  FILE* fp = fopen(path.c_str(), "wb");
+  fwrite(content.data(), 1, content.size(), fp);
+  fclose(fp);
+  return path;
+}
+}
+
+
+TEST(TokenCacheTest, StoreAndLoad) {
+  std::string source = rasp::testing::ReadFile("test/parser/sourcestream-test-cases/jquery.js");
+  rasp::CompilerOption compiler_option;
+  rasp::TokenCache token_cache(CacheDirectory().c_str());
+  std::remove(token_cache.CachePath(source.data(), source.size(), compiler_option.language_mode()).c_str());
+  
+  rasp::TokenStream expected;
+  rasp::Scanner<const char*> scanner(source.data(), source.data() + source.size(), compiler_option);
+  scanner.ScanAll(&expected);
+
+  rasp::TokenStream actual;
+  ASSERT_FALSE(token_cache.Load(source.data(), source.size(), compiler_option.language_mode(), &actual));
+  ASSERT_TRUE(token_cache.Store(source.data(), source.size(), compiler_option.language_mode(), expected));
+  ASSERT_TRUE(token_cache.Load(source.data(), source.size(), compiler_option.language_mode(), &actual));
+  ExpectSameTokens(expected, actual);
+
+  rasp::TokenStream harmony;
+  ASSERT_FALSE(token_cache.Load(source.data(), source.size(), rasp::LanguageMode::HARMONY, &harmony));
+  std::remove(token_cache.CachePath(source.data(), source.size(), compiler_option.language_mode()).c_str());
+}
+
+
+TEST(TokenCacheTest, Tokenize) {
+  std::string source = "var \\u0061bc = 'token cache test';\nabc += 1;";
+  rasp::CompilerOption compiler_option;
+  rasp::TokenCache token_cache(CacheDirectory().c_str());
+  std::remove(token_cache.CachePath(source.data(), source.size(), compiler_option.language_mode()).c_str());
+
+  rasp::TokenStream scanned;
+  rasp::TokenStream restored;
+  ASSERT_FALSE(token_cache.Tokenize(source.data(), source.size(), compiler_option, &scanned));
+  ASSERT_TRUE(token_cache.Tokenize(source.data(), source.size(), compiler_option, &restored));
+  ExpectSameTokens(scanned, restored);
+  EXPECT_EQ(restored.atom(1), restored.atom(4));
+
+  std::string changed = source + " ";
+  rasp::TokenStream rescanned;
+  ASSERT_FALSE(token_cache.Load(changed.data(), changed.size(), compiler_option.language_mode(), &rescanned));
+  std::remove(token_cache.CachePath(source.data(), source.size(), compiler_option.language_mode()).c_str());
+}
+
+
+TEST(TokenCacheTest, Load_broken_cache) {
+  std::string source = "function broken_cache() {return 1}";
+  rasp::CompilerOption compiler_option;
+  rasp::TokenCache token_cache(CacheDirectory().c_str());
+  std::string path = token_cache.CachePath(source.data(), source.size(), compiler_option.language_mode());
+  rasp::TokenStream scanned;
+  token_cache.Tokenize(source.data(), source.size(), compiler_option, &scanned);
+
+  std::string content = rasp::testing::ReadFile(path.c_str());
+  FILE* fp = fopen(path.c_str(), "wb");
+  ASSERT_TRUE(fp != nullptr);
+  fwrite(content.data(), 1, content.size() - 3, fp);
+  fclose(fp);
+
+  rasp::TokenStream restored;
+  ASSERT_FALSE(token_cache.Load(source.data(), source.size(), compiler_option.language_mode(), &restored));
+  EXPECT_EQ(restored.size(), 0u);
+  std::remove(path.c_str());
+}
+
+
+TEST(TokenCacheTest, Load_corrupt_count) {
+  std::string source = "var corrupt_count = 1;";
+  rasp::CompilerOption compiler_option;
+  rasp::TokenCache token_cache(CacheDirectory().c_str());
+  std::string body;
+  WriteVarint(static_cast<uint64_t>(1) << 58, &body);
+  body.append(16, '\0');
+  std::string path = RewriteCacheBody(token_cache, source, compiler_option, body);
+
+  rasp::TokenStream restored;
+  ASSERT_FALSE(token_cache.Load(source.data(), source.size(), compiler_option.language_mode(), &restored));
+  EXPECT_EQ(restored.size(), 0u);
+  std::remove(path.c_str());
+}
+
+
+TEST(TokenCacheTest, Load_corrupt_span) {
+  std::string source = "var corrupt_span = 1;";
+  rasp::CompilerOption compiler_option;
+  rasp::TokenCache token_cache(CacheDirectory().c_str());
+  std::string body;
+  WriteVarint(1, &body);
+  WriteVarint(static_cast<uint64_t>(rasp::Token::JS_IDENTIFIER), &body);
+  WriteVarint(0xFFFFFFFFFFFFFF00ull, &body);
+  WriteVarint(0x103, &body);
+  body.push_back('\0');
+  WriteVarint(0, &body);
+  std::string path = RewriteCacheBody(token_cache, source, compiler_option, body);
+
+  rasp::TokenStream restored;
+  ASSERT_FALSE(token_cache.Load(source.data(), source.size(), compiler_option.language_mode(), &restored));
+  EXPECT_EQ(restored.size(), 0u);
+
+  body.clear();
+  WriteVarint(1, &body);
+  WriteVarint(static_cast<uint64_t>(rasp::Token::JS_VAR), &body);
+  WriteVarint(0, &body);
+  WriteVarint(3, &body);
+  body.push_back('\0');
+  WriteVarint(1, &body);
+  WriteVarint(0, &body);
+  WriteVarint(0xFFFFFFFFFFFFFF00ull, &body);
+  WriteVarint(0x103, &body);
+  RewriteCacheBody(token_cache, source, compiler_option, body);
+  ASSERT_FALSE(token_cache.Load(source.data(), source.size(), compiler_option.language_mode(), &restored));
+  EXPECT_EQ(restored.size(), 0u);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,214 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "../../src/compiler-option.h"
+#include "../../src/parser/scanner.h"
+#include "../../src/parser/token-stream.h"
+#include "../readfile.h"
+#include "../unicode-util.h"
+
+
+TEST(TokenStreamTest, ScanAll) {
+  const char* source = "var foo = 'a\\nb';\nfoo += 0x10\n";
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  rasp::TokenStream token_stream;
+  scanner.ScanAll(&token_stream);
+
+  const rasp::Token types[] = {
+    rasp::Token::JS_VAR, rasp::Token::JS_IDENTIFIER, rasp::Token::JS_ASSIGN,
+    rasp::Token::JS_STRING_LITERAL, rasp::Token::JS_IDENTIFIER, rasp::Token::JS_ADD_LET,
+    rasp::Token::JS_NUMERIC_LITERAL, rasp::Token::END_OF_INPUT
+  };
+  const uint32_t offsets[] = {0, 4, 8, 10, 18, 22, 25, 30};
+  const uint32_t lengths[] = {3, 3, 1, 6, 3, 2, 4, 0};
+  ASSERT_EQ(token_stream.size(), sizeof(types) / sizeof(types[0]));
+  for (size_t i = 0; i < token_stream.size(); i++) {
+    EXPECT_EQ(token_stream.type(i), types[i]) << i;
+    EXPECT_EQ(token_stream.offset(i), offsets[i]) << i;
+    EXPECT_EQ(token_stream.length(i), lengths[i]) << i;
+  }
+  EXPECT_TRUE(token_stream.has_escapes(3));
+  EXPECT_FALSE(token_stream.has_escapes(1));
+  EXPECT_TRUE(token_stream.has_line_terminator_before_next(3));
+  EXPECT_FALSE(token_stream.has_line_terminator_before_next(4));
+  EXPECT_EQ(token_stream.atom(1), token_stream.atom(4));
+  EXPECT_NE(token_stream.atom(1), rasp::AtomTable::kInvalidAtom);
+  EXPECT_EQ(token_stream.atom(0), rasp::AtomTable::kInvalidAtom);
+}
+
+
+TEST(TokenStreamTest, ScanBatch) {
+  const char* source = "a b c d e";
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  rasp::TokenStream token_stream;
+  ASSERT_EQ(scanner.ScanBatch(&token_stream, 2), 2u);
+  ASSERT_EQ(scanner.ScanBatch(&token_stream, 2), 2u);
+  ASSERT_EQ(scanner.ScanBatch(&token_stream, 10), 2u);
+  ASSERT_EQ(scanner.ScanBatch(&token_stream, 10), 0u);
+  ASSERT_EQ(token_stream.size(), 6u);
+  EXPECT_EQ(token_stream.offset(4), 8u);
+  EXPECT_EQ(token_stream.type(5), rasp::Token::END_OF_INPUT);
+}
+
+
+namespace {
+void ExpectIllegalNumber(const char* source, rasp::LanguageMode language_mode) {
+  rasp::CompilerOption compiler_option;
+  compiler_option.set_language_mode(language_mode);
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  rasp::TokenStream token_stream;
+  scanner.ScanAll(&token_stream);
+  const rasp::Token types[] = {
+    rasp::Token::JS_IDENTIFIER, rasp::Token::JS_ASSIGN, rasp::Token::ILLEGAL,
+    rasp::Token::JS_IDENTIFIER, rasp::Token::END_OF_INPUT
+  };
+  ASSERT_EQ(token_stream.size(), sizeof(types) / sizeof(types[0]));
+  for (size_t i = 0; i < token_stream.size(); i++) {
+    EXPECT_EQ(token_stream.type(i), types[i]) << i;
+  }
+  EXPECT_EQ(token_stream.offset(3), strlen(source) - 1);
+}
+}
+
+
+TEST(TokenStreamTest, ScanAll_strict_octal_literal) {
+  ExpectIllegalNumber("x=01 y", rasp::LanguageMode::ES5_STRICT);
+  ExpectIllegalNumber("x=01 y", rasp::LanguageMode::HARMONY);
+}
+
+
+TEST(TokenStreamTest, ScanAll_es3_binary_literal) {
+  ExpectIllegalNumber("x=0o1 y", rasp::LanguageMode::ES3);
+  ExpectIllegalNumber("x=0o1 y", rasp::LanguageMode::ES5_STRICT);
+}
+
+
+TEST(TokenStreamTest, ScanBatch_error_token_makes_progress) {
+  const char* source = "x=01";
+  rasp::CompilerOption compiler_option;
+  compiler_option.set_language_mode(rasp::LanguageMode::ES5_STRICT);
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  rasp::TokenStream token_stream;
+  ASSERT_EQ(scanner.ScanBatch(&token_stream, 1000), 4u);
+  EXPECT_EQ(token_stream.type(2), rasp::Token::ILLEGAL);
+  EXPECT_EQ(token_stream.length(2), 2u);
+  EXPECT_EQ(token_stream.type(3), rasp::Token::END_OF_INPUT);
+}
+
+
+TEST(TokenStreamTest, ScanAll_same_tokens_as_scan) {
+  std::string source = rasp::testing::ReadFile("test/parser/sourcestream-test-cases/jquery.js");
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<const char*> scanner(source.data(), source.data() + source.size(), compiler_option);
+  rasp::Scanner<const char*> expected_scanner(source.data(), source.data() + source.size(), compiler_option);
+  rasp::TokenStream token_stream(source.size());
+  size_t capacity = rasp::TokenStream::EstimateTokenCount(source.size());
+  scanner.ScanAll(&token_stream);
+
+  for (size_t i = 0; i < token_stream.size(); i++) {
+    const rasp::TokenInfo* token_info = expected_scanner.Scan();
+    ASSERT_EQ(token_stream.type(i), token_info->type()) << i;
+    ASSERT_EQ(token_stream.offset(i), token_info->source_offset()) << i;
+    ASSERT_EQ(token_stream.length(i), token_info->source_length()) << i;
+    ASSERT_EQ(token_stream.has_line_terminator_before_next(i),
+              expected_scanner.has_line_terminator_before_next()) << i;
+  }
+  EXPECT_EQ(token_stream.type(token_stream.size() - 1), rasp::Token::END_OF_INPUT);
+  EXPECT_GE(capacity, token_stream.size());
+}
+
+
+TEST(TokenStreamTest, ScanAll_comments) {
+  const char* source = "/* license */\n/** a */ var a; /* b */ /* c */ a // d\n/* e */";
+  rasp::CompilerOption compiler_option;
+  rasp::Scanner<const char*> scanner(source, source + strlen(source), compiler_option);
+  rasp::TokenStream token_stream;
+  scanner.ScanAll(&token_stream);
+
+  ASSERT_EQ(token_stream.size(), 4u);
+  const uint32_t offsets[] = {0, 14, 30, 38, 53};
+  const uint32_t lengths[] = {13, 8, 7, 7, 7};
+  const uint32_t tokens[] = {0, 0, 2, 2, 3};
+  ASSERT_EQ(token_stream.comment_count(), 5u);
+  for (size_t i = 0; i < 5; i++) {
+    EXPECT_EQ(token_stream.comment_offset(i), offsets[i]) << i;
+    EXPECT_EQ(token_stream.comment_length(i), lengths[i]) << i;
+    EXPECT_EQ(token_stream.comment_token(i), tokens[i]) << i;
+  }
+  EXPECT_EQ(token_stream.FindComment(1), 2u);
+  EXPECT_EQ(token_stream.FindComment(2), 2u);
+  EXPECT_EQ(token_stream.FindComment(4), 5u);
+
+  std::vector<rasp::UChar> uchars = rasp::testing::AsciiToUCharVector(source);
+  rasp::Scanner<std::vector<rasp::UChar>::iterator> uchar_scanner(uchars.begin(), uchars.end(), compiler_option);
+  rasp::TokenStream uchar_token_stream;
+  uchar_scanner.ScanAll(&uchar_token_stream);
+  ASSERT_EQ(uchar_token_stream.comment_count(), token_stream.comment_count());
+  for (size_t i = 0; i < token_stream.comment_count(); i++) {
+    EXPECT_EQ(uchar_token_stream.comment_offset(i), token_stream.comment_offset(i)) << i;
+    EXPECT_EQ(uchar_token_stream.comment_length(i), token_stream.comment_length(i)) << i;
+    EXPECT_EQ(uchar_token_stream.comment_token(i), token_stream.comment_token(i)) << i;
+  }
+}
+
+
+TEST(TokenStreamTest, Append_comments) {
+  rasp::TokenStream token_stream;
+  token_stream.PushComment(0, 2);
+  token_stream.Push(rasp::Token::JS_VAR, 2, 3, 0, rasp::AtomTable::kInvalidAtom);
+  token_stream.PushComment(5, 2);
+  token_stream.PushComment(7, 2);
+  token_stream.Push(rasp::Token::JS_IDENTIFIER, 9, 1, 0, rasp::AtomTable::kInvalidAtom);
+  token_stream.PushComment(10, 2);
+  token_stream.Push(rasp::Token::END_OF_INPUT, 12, 0, 0, rasp::AtomTable::kInvalidAtom);
+
+  rasp::TokenStream all;
+  all.Append(token_stream);
+  ASSERT_EQ(all.comment_count(), 4u);
+  EXPECT_EQ(all.comment_token(0), 0u);
+  EXPECT_EQ(all.comment_token(3), 2u);
+
+  // The comments before the begin are appended only by the AppendComments.
+  rasp::TokenStream range;
+  range.Push(rasp::Token::JS_VAR, 0, 1, 0, rasp::AtomTable::kInvalidAtom);
+  range.AppendComments(token_stream, 1);
+  range.Append(token_stream, 1, 3);
+  ASSERT_EQ(range.comment_count(), 3u);
+  EXPECT_EQ(range.comment_offset(0), 5u);
+  EXPECT_EQ(range.comment_token(0), 1u);
+  EXPECT_EQ(range.comment_token(1), 1u);
+  EXPECT_EQ(range.comment_offset(2), 10u);
+  EXPECT_EQ(range.comment_token(2), 2u);
+
+  token_stream.Truncate(1);
+  EXPECT_EQ(token_stream.size(), 1u);
+  EXPECT_EQ(token_stream.comment_count(), 1u);
+  token_stream.Clear();
+  EXPECT_EQ(token_stream.comment_count(), 0u);
+}
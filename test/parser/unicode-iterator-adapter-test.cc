@@ -83,7 +83,7 @@ inline void UnicodeTest(const char* input, const char* expected, size_t expected
         rasp::SPrintf(buffer, true, kFormat, uc.ToLowSurrogate());
       }
     }
-    utf8_buffer.append(uc.utf8());
+    utf8_buffer.append(uc.ToUtf8().data());
     size += uc.IsSurrogatePair()? 2: 1;
     index++;
   }
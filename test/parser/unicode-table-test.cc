@@ -0,0 +1,62 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include "../../src/parser/unicode-table.h"
+
+
+TEST(UnicodeTableTest, IsIdentifierStart) {
+  const rasp::UC32 starts[] = {'a', 'Z', '$', '_', 0xC0, 0x3042, 0x65E5, 0x2118, 0x309B, 0x2000B};
+  for (rasp::UC32 c: starts) {
+    ASSERT_TRUE(rasp::UnicodeTable::IsIdentifierStart(c)) << c;
+  }
+  const rasp::UC32 others[] = {'0', ' ', '\\', 0xD7, 0x0661, 0x0301, 0x200D, 0x2E2F, 0x3000, 0x10FFFF};
+  for (rasp::UC32 c: others) {
+    ASSERT_FALSE(rasp::UnicodeTable::IsIdentifierStart(c)) << c;
+  }
+}
+
+
+TEST(UnicodeTableTest, IsIdentifierPart) {
+  const rasp::UC32 parts[] = {'a', '0', '$', 0x0661, 0x0301, 0x00B7, 0x200C, 0x200D, 0xFF3F, 0xE0100};
+  for (rasp::UC32 c: parts) {
+    ASSERT_TRUE(rasp::UnicodeTable::IsIdentifierPart(c)) << c;
+  }
+  const rasp::UC32 others[] = {'-', ' ', 0xD7, 0x2028, 0x3000, 0xE01F0, 0x10FFFF};
+  for (rasp::UC32 c: others) {
+    ASSERT_FALSE(rasp::UnicodeTable::IsIdentifierPart(c)) << c;
+  }
+}
+
+
+TEST(UnicodeTableTest, IsWhiteSpace) {
+  const rasp::UC32 spaces[] = {'\t', '\n', ' ', 0xA0, 0x1680, 0x2000, 0x200A, 0x2028, 0x2029, 0x202F, 0x3000, 0xFEFF};
+  for (rasp::UC32 c: spaces) {
+    ASSERT_TRUE(rasp::UnicodeTable::IsWhiteSpace(c)) << c;
+  }
+  const rasp::UC32 others[] = {'a', 0x180E, 0x200B, 0x3042, 0x10000, 0x10FFFF};
+  for (rasp::UC32 c: others) {
+    ASSERT_FALSE(rasp::UnicodeTable::IsWhiteSpace(c)) << c;
+  }
+}
@@ -0,0 +1,75 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2013 Taketoshi Aono(brn)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include "../../src/parser/utfstring.h"
+
+namespace {
+const char kSource[] = "a\xc3\xa9\xe3\x81\x82\xf0\x9f\x98\x80";
+
+rasp::Utf16String Expected() {
+  rasp::Utf16String expected;
+  expected += 'a';
+  expected += 0xE9;
+  expected += 0x3042;
+  expected += 0xD83D;
+  expected += 0xDE00;
+  return expected;
+}
+}
+
+
+TEST(UtfStringTest, utf8) {
+  rasp::UtfString str(kSource);
+  ASSERT_TRUE(str.encoding() == rasp::UtfString::Encoding::UTF8);
+  ASSERT_STREQ(kSource, str.ToUtf8Value().value());
+  ASSERT_TRUE(Expected() == str.ToUtf16Value().value());
+  // The utf-16 view is converted again after the string is changed.
+  str.Append("b", "b" + 1);
+  ASSERT_EQ(6u, str.utf16_length());
+  ASSERT_EQ('b', str.ToUtf16Value().value()[5]);
+}
+
+
+TEST(UtfStringTest, utf16) {
+  rasp::UtfString str(rasp::UtfString::Encoding::UTF16);
+  str.Append(kSource, kSource + sizeof(kSource) - 1);
+  ASSERT_TRUE(str.encoding() == rasp::UtfString::Encoding::UTF16);
+  ASSERT_TRUE(Expected() == str.ToUtf16Value().value());
+  ASSERT_STREQ(kSource, str.ToUtf8Value().value());
+  str += rasp::UChar(0x20000);
+  ASSERT_EQ(7u, str.utf16_length());
+  ASSERT_STREQ("a\xc3\xa9\xe3\x81\x82\xf0\x9f\x98\x80\xf0\xa0\x80\x80", str.ToUtf8Value().value());
+}
+
+
+TEST(UtfStringTest, append_other_encoding) {
+  rasp::UtfString utf16(rasp::UtfString::Encoding::UTF16);
+  utf16.Append(kSource, kSource + sizeof(kSource) - 1);
+  rasp::UtfString utf8("foo");
+  utf8 += utf16;
+  ASSERT_TRUE(utf8.encoding() == rasp::UtfString::Encoding::UTF8);
+  ASSERT_STREQ("foo" "a\xc3\xa9\xe3\x81\x82\xf0\x9f\x98\x80", utf8.ToUtf8Value().value());
+  ASSERT_EQ(8u, utf8.utf16_length());
+}
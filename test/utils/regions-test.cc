@@ -26,6 +26,7 @@
 #include <random>
 #include <thread>
 #include <memory>
+#include <vector>
 #include "../../src/utils/regions.h"
 #include "../../src/utils/systeminfo.h"
 #include "../../src/utils/utils.h"
@@ -134,6 +135,37 @@ TEST_F(RegionsTest, RegionsTest_allocate_from_chunk_array) {
 }
 
 
+TEST_F(RegionsTest, RegionsTest_allocate_with_trailing_space) {
+  uint64_t ok = 0u;
+  rasp::Regions p(1024);
+  for (size_t i = 0; i < 100; i++) {
+    Test1<>* object = p.NewWithTrailingSpace<Test1<>>(i, &ok);
+    memset(reinterpret_cast<char*>(object) + sizeof(Test1<>), 0xFF, i);
+  }
+  p.Destroy();
+  ASSERT_EQ(100u, ok);
+}
+
+
+TEST_F(RegionsTest, RegionsTest_allocate_raw) {
+  rasp::Regions p(1024);
+  std::vector<char*> blocks;
+  for (size_t i = 1; i < 100; i++) {
+    char* block = static_cast<char*>(p.AllocateRaw(i * 37));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % rasp::kAlignment, 0u);
+    memset(block, static_cast<int>(i), i * 37);
+    blocks.push_back(block);
+  }
+  char* huge = static_cast<char*>(p.AllocateRaw(1024 * 1024));
+  memset(huge, 0xFF, 1024 * 1024);
+  for (size_t i = 1; i < 100; i++) {
+    for (size_t j = 0; j < i * 37; j++) {
+      ASSERT_EQ(blocks[i - 1][j], static_cast<char>(i));
+    }
+  }
+}
+
+
 TEST_F(RegionsTest, RegionsTest_allocate_many_from_chunk) {
   rasp::Regions p(1024);
   uint64_t ok = 0u;
@@ -435,3 +467,22 @@ TEST_F(RegionsTest, RegionsTest_thread_random_dealloc) {
   p.Destroy();
   ASSERT_EQ(kStackSize, ok);
 }
+
+
+TEST_F(RegionsTest, RegionsTest_standard_allocator) {
+  rasp::Regions p(1024);
+  typedef rasp::Regions::RegionsStandardAllocator<int> Allocator;
+  std::vector<int, Allocator> v((Allocator(&p)));
+  for (int i = 0; i < 10000; i++) {
+    v.push_back(i);
+  }
+  for (int i = 0; i < 10000; i++) {
+    ASSERT_EQ(i, v[i]);
+  }
+  std::vector<int, Allocator> heap;
+  heap.assign(v.begin(), v.end());
+  ASSERT_TRUE(heap.get_allocator().regions() == nullptr);
+  ASSERT_EQ(v.size(), heap.size());
+  v.clear();
+  v.shrink_to_fit();
+}
@@ -0,0 +1,164 @@
+#!/usr/bin/env python
+#
+# Generate src/parser/operator-table.cc.
+# The table is the longest match DFA of the all punctuators and operators
+# which is used by Scanner::ScanOperator in src/parser/scanner-inl.h.
+# The harmony punctuators are reachable only from the harmony start state.
+# The equivalent states of the both DFA are merged.
+#
+# usage: python tools/gen-operator-table.py > src/parser/operator-table.cc
+
+import os
+import sys
+
+OPERATORS = [
+  ('(', 'JS_LEFT_PAREN'),
+  (')', 'JS_RIGHT_PAREN'),
+  (':', 'JS_COLON'),
+  ('?', 'JS_QUESTION_MARK'),
+  ('[', 'JS_LEFT_BRACKET'),
+  (']', 'JS_RIGHT_BRACKET'),
+  ('{', 'JS_LEFT_BRACE'),
+  ('}', 'JS_RIGHT_BRACE'),
+  ('+', 'JS_PLUS'),
+  ('+=', 'JS_ADD_LET'),
+  ('++', 'JS_INCREMENT'),
+  ('-', 'JS_MINUS'),
+  ('-=', 'JS_SUB_LET'),
+  ('--', 'JS_DECREMENT'),
+  ('*', 'JS_MUL'),
+  ('*=', 'JS_MUL_LET'),
+  ('/', 'JS_DIV'),
+  ('/=', 'JS_DIV_LET'),
+  ('%', 'JS_MOD'),
+  ('%=', 'JS_MOD_LET'),
+  ('~', 'JS_BIT_NOR'),
+  ('~=', 'JS_NOR_LET'),
+  ('^', 'JS_BIT_XOR'),
+  ('^=', 'JS_XOR_LET'),
+  ('&', 'JS_BIT_AND'),
+  ('&=', 'JS_AND_LET'),
+  ('&&', 'JS_LOGICAL_AND'),
+  ('|', 'JS_BIT_OR'),
+  ('|=', 'JS_OR_LET'),
+  ('||', 'JS_LOGICAL_OR'),
+  ('=', 'JS_ASSIGN'),
+  ('==', 'JS_EQUAL'),
+  ('===', 'JS_EQ'),
+  ('!', 'JS_NOT'),
+  ('!=', 'JS_NOT_EQUAL'),
+  ('!==', 'JS_NOT_EQ'),
+  ('<', 'JS_LESS'),
+  ('<=', 'JS_LESS_EQUAL'),
+  ('<<', 'JS_SHIFT_LEFT'),
+  ('<<=', 'JS_SHIFT_LEFT_LET'),
+  ('>', 'JS_GREATER'),
+  ('>=', 'JS_GREATER_EQUAL'),
+  ('>>', 'JS_SHIFT_RIGHT'),
+  ('>>=', 'JS_SHIFT_RIGHT_LET'),
+  ('>>>', 'JS_U_SHIFT_RIGHT'),
+  ('>>>=', 'JS_U_SHIFT_RIGHT_LET'),
+]
+
+HARMONY_OPERATORS = [
+  ('=>', 'JS_FUNCTION_GLYPH'),
+  ('...', 'JS_REST_PARAMETER'),
+]
+
+script_dir = os.path.dirname(os.path.abspath(__file__))
+
+
+def License():
+  with open(os.path.join(script_dir, '..', 'src', 'parser', 'scanner.h')) as f:
+    lines = []
+    for line in f:
+      lines.append(line.rstrip('\r\n'))
+      if line.strip() == '*/':
+        break
+  return '\n'.join(lines)
+
+
+def CharClasses():
+  chars = sorted(set(c for op, _ in OPERATORS + HARMONY_OPERATORS for c in op))
+  # The class 0 is the character which is not used by any operators.
+  return dict((c, i + 1) for i, c in enumerate(chars))
+
+
+class Builder(object):
+  def __init__(self, class_count):
+    self.class_count = class_count
+    # The state 0 is the dead state.
+    self.states = [('ILLEGAL', (0,) * class_count)]
+    self.ids = {self.states[0]: 0}
+
+  def Intern(self, trie, classes):
+    transitions = [0] * self.class_count
+    for c, child in trie['next'].items():
+      transitions[classes[c]] = self.Intern(child, classes)
+    state = (trie['token'], tuple(transitions))
+    if state not in self.ids:
+      self.ids[state] = len(self.states)
+      self.states.append(state)
+    return self.ids[state]
+
+
+def Trie(operators):
+  root = {'token': 'ILLEGAL', 'next': {}}
+  for op, token in operators:
+    node = root
+    for c in op:
+      node = node['next'].setdefault(c, {'token': 'ILLEGAL', 'next': {}})
+    node['token'] = token
+  return root
+
+
+def main():
+  classes = CharClasses()
+  class_count = len(classes) + 1
+  builder = Builder(class_count)
+  start = builder.Intern(Trie(OPERATORS), classes)
+  harmony_start = builder.Intern(Trie(OPERATORS + HARMONY_OPERATORS), classes)
+  states = builder.states
+
+  out = sys.stdout
+  out.write(License() + '\n\n')
+  out.write('// This file is generated by tools/gen-operator-table.py, do not edit.\n\n')
+  out.write('#include "operator-table.h"\n\n')
+  out.write('namespace rasp {\n\n')
+  out.write('static_assert(OperatorTable::kClassCount == %d, "Regenerate operator-table.cc.");\n' % class_count)
+  out.write('static_assert(OperatorTable::kStateCount == %d, "Regenerate operator-table.cc.");\n' % len(states))
+  out.write('static_assert(OperatorTable::kStartState == %d, "Regenerate operator-table.cc.");\n' % start)
+  out.write('static_assert(OperatorTable::kHarmonyStartState == %d, "Regenerate operator-table.cc.");\n\n' % harmony_start)
+  out.write('const uint8_t OperatorTable::kStartState;\n')
+  out.write('const uint8_t OperatorTable::kHarmonyStartState;\n')
+  out.write('const uint8_t OperatorTable::kClassCount;\n')
+  out.write('const uint8_t OperatorTable::kStateCount;\n\n\n')
+
+  out.write('const uint8_t OperatorTable::kCharClass[] = {\n')
+  for i in range(128):
+    c = chr(i)
+    if c in classes:
+      out.write('  %d, // %d %s\n' % (classes[c], i, c))
+    else:
+      out.write('  0, // %d\n' % i)
+  out.write('};\n\n\n')
+
+  chars = sorted(classes, key=lambda c: classes[c])
+  out.write('// Columns: other %s\n' % ' '.join(chars))
+  out.write('const uint8_t OperatorTable::kTransitions[][OperatorTable::kClassCount] = {\n')
+  for i, (token, transitions) in enumerate(states):
+    out.write('  {%s}, // %d\n' % (', '.join('%d' % t for t in transitions), i))
+  out.write('};\n\n\n')
+
+  out.write('const Token OperatorTable::kAccept[] = {\n')
+  for i, (token, transitions) in enumerate(states):
+    out.write('  Token::%s, // %d\n' % (token, i))
+  out.write('};\n')
+  out.write('}\n')
+
+  sys.stderr.write('kStartState = %d, kHarmonyStartState = %d, kClassCount = %d, kStateCount = %d\n'
+                   % (start, harmony_start, class_count, len(states)))
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,64 @@
+#!/usr/bin/env python
+#
+# Generate src/parser/power-of-ten-table.cc.
+# The table holds the 128-bit mantissas of the powers of ten which are used by
+# the Eisel-Lemire algorithm in src/parser/numeric-conversion.cc.
+# Each mantissa is normalized so that the most significant bit is set,
+# and is truncated (rounded toward zero).
+#
+# usage: python tools/gen-power-of-ten-table.py > src/parser/power-of-ten-table.cc
+
+import os
+import sys
+
+MIN_EXPONENT = -348
+MAX_EXPONENT = 347
+
+script_dir = os.path.dirname(os.path.abspath(__file__))
+
+
+def License():
+  with open(os.path.join(script_dir, '..', 'src', 'parser', 'scanner.h')) as f:
+    lines = []
+    for line in f:
+      lines.append(line.rstrip('\r\n'))
+      if line.strip() == '*/':
+        break
+  return '\n'.join(lines)
+
+
+def Mantissa(exponent):
+  if exponent >= 0:
+    value = 10 ** exponent
+    while value < (1 << 127):
+      value <<= 1
+    while value >= (1 << 128):
+      value >>= 1
+    return value
+  power = 10 ** -exponent
+  shift = power.bit_length() + 127
+  value = (1 << shift) // power
+  while value >= (1 << 128):
+    value >>= 1
+  return value
+
+
+def main():
+  out = sys.stdout
+  out.write(License() + '\n\n')
+  out.write('// This file is generated by tools/gen-power-of-ten-table.py, do not edit.\n\n')
+  out.write('#include "numeric-conversion.h"\n\n')
+  out.write('namespace rasp {\n\n')
+  out.write('const int NumericConversion::kMinPowerOfTenExponent;\n')
+  out.write('const int NumericConversion::kMaxPowerOfTenExponent;\n\n\n')
+  out.write('// {low, high} of the mantissa of 10^e for e in [%d, %d].\n' % (MIN_EXPONENT, MAX_EXPONENT))
+  out.write('const uint64_t NumericConversion::kPowerOfTenTable[][2] = {\n')
+  for exponent in range(MIN_EXPONENT, MAX_EXPONENT + 1):
+    value = Mantissa(exponent)
+    out.write('  {0x%016xULL, 0x%016xULL}, // 1e%d\n' % (value & ((1 << 64) - 1), value >> 64, exponent))
+  out.write('};\n')
+  out.write('}\n')
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+#
+# Generate src/parser/unicode-table.cc.
+# The tables are the two level lookup tables of the identifier and the white space properties
+# which are used by Character in src/parser/character.h for the non ascii characters.
+# The first level maps the page, the upper bits of the code point, to the block,
+# and the second level is the bitmap of the block. The equivalent blocks are merged.
+# The properties are read from the unicodedata module of the python.
+#
+# usage: python tools/gen-unicode-table.py > src/parser/unicode-table.cc
+
+import os
+import sys
+import unicodedata
+
+PAGE_BITS = 8
+PAGE_SIZE = 1 << PAGE_BITS
+CODE_POINT_COUNT = 0x110000
+
+# The Other_ID_Start and the Other_ID_Continue of the PropList.txt,
+# which are not derived from the general category.
+OTHER_ID_START = [0x1885, 0x1886, 0x2118, 0x212E, 0x309B, 0x309C]
+OTHER_ID_CONTINUE = [0x00B7, 0x0387, 0x19DA] + list(range(0x1369, 0x1372))
+# The Pattern_Syntax characters which are the letters.
+PATTERN_SYNTAX_LETTERS = [0x2E2F]
+
+ID_START_CATEGORIES = ('Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Nl')
+ID_CONTINUE_CATEGORIES = ('Mn', 'Mc', 'Nd', 'Pc')
+
+script_dir = os.path.dirname(os.path.abspath(__file__))
+
+
+def License():
+  with open(os.path.join(script_dir, '..', 'src', 'parser', 'scanner.h')) as f:
+    lines = []
+    for line in f:
+      lines.append(line.rstrip('\r\n'))
+      if line.strip() == '*/':
+        break
+  return '\n'.join(lines)
+
+
+def Category(c):
+  return unicodedata.category(chr(c) if sys.version_info[0] >= 3 else unichr(c))
+
+
+# The IdentifierStart of the ECMAScript, the ID_Start and the '$' and the '_'.
+def IsIdentifierStart(c):
+  if c in PATTERN_SYNTAX_LETTERS:
+    return False
+  return Category(c) in ID_START_CATEGORIES or c in OTHER_ID_START or c in (0x24, 0x5F)
+
+
+# The IdentifierPart of the ECMAScript, the ID_Continue and the ZWNJ and the ZWJ.
+def IsIdentifierPart(c):
+  return (IsIdentifierStart(c) or Category(c) in ID_CONTINUE_CATEGORIES or
+          c in OTHER_ID_CONTINUE or c in (0x200C, 0x200D))
+
+
+# The WhiteSpace and the LineTerminator of the ECMAScript.
+def IsWhiteSpace(c):
+  return Category(c) == 'Zs' or c in (0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0xFEFF, 0x2028, 0x2029)
+
+
+def Pages(predicate, blocks, ids):
+  pages = []
+  for page in range(CODE_POINT_COUNT >> PAGE_BITS):
+    words = []
+    for word in range(PAGE_SIZE // 32):
+      bits = 0
+      for bit in range(32):
+        if predicate((page << PAGE_BITS) + word * 32 + bit):
+          bits |= 1 << bit
+      words.append(bits)
+    block = tuple(words)
+    if block not in ids:
+      ids[block] = len(blocks)
+      blocks.append(block)
+    pages.append(ids[block])
+  # The pages after the last non empty page are not stored.
+  while pages and pages[-1] == 0:
+    pages.pop()
+  return pages
+
+
+def WritePages(out, name, pages):
+  out.write('const uint8_t UnicodeTable::%s[] = {\n' % name)
+  for i in range(0, len(pages), 16):
+    out.write('  %s, // U+%04X\n' % (', '.join('%d' % p for p in pages[i:i + 16]), i << PAGE_BITS))
+  out.write('};\n\n\n')
+
+
+def main():
+  # The block 0 is the empty block.
+  empty = (0,) * (PAGE_SIZE // 32)
+  blocks = [empty]
+  ids = {empty: 0}
+  properties = [
+    ('kIdentifierStartPages', 'kIdentifierStartPageCount', Pages(IsIdentifierStart, blocks, ids)),
+    ('kIdentifierPartPages', 'kIdentifierPartPageCount', Pages(IsIdentifierPart, blocks, ids)),
+    ('kWhiteSpacePages', 'kWhiteSpacePageCount', Pages(IsWhiteSpace, blocks, ids)),
+  ]
+  if len(blocks) > 256:
+    sys.stderr.write('The block count %d exceeds the uint8_t range.\n' % len(blocks))
+    sys.exit(1)
+
+  out = sys.stdout
+  out.write(License() + '\n\n')
+  out.write('// This file is generated by tools/gen-unicode-table.py, do not edit.\n')
+  out.write('// Unicode %s\n\n' % unicodedata.unidata_version)
+  out.write('#include "unicode-table.h"\n\n')
+  out.write('namespace rasp {\n\n')
+  out.write('static_assert(UnicodeTable::kPageBits == %d, "Regenerate unicode-table.cc.");\n' % PAGE_BITS)
+  out.write('static_assert(UnicodeTable::kBlockCount == %d, "Regenerate unicode-table.cc.");\n' % len(blocks))
+  for _, count, pages in properties:
+    out.write('static_assert(UnicodeTable::%s == %d, "Regenerate unicode-table.cc.");\n' % (count, len(pages)))
+  out.write('\n')
+  out.write('const uint8_t UnicodeTable::kPageBits;\n')
+  out.write('const size_t UnicodeTable::kBlockCount;\n')
+  for _, count, _ in properties:
+    out.write('const size_t UnicodeTable::%s;\n' % count)
+  out.write('\n\n')
+
+  for name, _, pages in properties:
+    WritePages(out, name, pages)
+
+  out.write('const uint32_t UnicodeTable::kBlocks[][UnicodeTable::kBlockWords] = {\n')
+  for i, block in enumerate(blocks):
+    out.write('  {%s}, // %d\n' % (', '.join('0x%08x' % w for w in block), i))
+  out.write('};\n')
+  out.write('}\n')
+
+  sys.stderr.write('kBlockCount = %d, %s\n' % (len(blocks), ', '.join(
+      '%s = %d' % (count, len(pages)) for _, count, pages in properties)))
+
+
+if __name__ == '__main__':
+  main()